@@ -53,10 +53,24 @@ void ACattleAIController::OnPossess(APawn *InPawn)
         UE_LOG(LogCattleAI, Error, TEXT("[CattleAIController] No BehaviorTree or BlackboardAsset assigned! BehaviorTree=%s"),
                BehaviorTree ? *BehaviorTree->GetName() : TEXT("NULL"));
     }
+
+    // Area blackboard values are pushed on enter/exit instead of polled
+    if (ACattleAnimal *Animal = GetCattleAnimal())
+    {
+        Animal->OnAreaEntered.AddDynamic(this, &ACattleAIController::HandleAreaTransition);
+        Animal->OnAreaExited.AddDynamic(this, &ACattleAIController::HandleAreaTransition);
+        UpdateAreaBlackboard();
+    }
 }
 
 void ACattleAIController::OnUnPossess()
 {
+    if (ACattleAnimal *Animal = GetCattleAnimal())
+    {
+        Animal->OnAreaEntered.RemoveDynamic(this, &ACattleAIController::HandleAreaTransition);
+        Animal->OnAreaExited.RemoveDynamic(this, &ACattleAIController::HandleAreaTransition);
+    }
+
     BehaviorTreeComp->StopTree();
     Super::OnUnPossess();
 }
@@ -101,6 +115,11 @@ void ACattleAIController::UpdateAreaBlackboard()
     BlackboardComp->SetValueAsVector(KEY_FlowDirection, Influence.InfluenceDirection);
 }
 
+void ACattleAIController::HandleAreaTransition(ACattleAnimal *Animal, ACattleAreaBase *Area)
+{
+    UpdateAreaBlackboard();
+}
+
 void ACattleAIController::SetTargetLocation(const FVector &Location)
 {
     if (BlackboardComp)
@@ -9,6 +9,7 @@
 class UBehaviorTreeComponent;
 class UBlackboardComponent;
 class ACattleAnimal;
+class ACattleAreaBase;
 
 /**
  * ACattleAIController
@@ -96,4 +97,8 @@ protected:
 private:
     /** Initialize blackboard with default values for cattle AI */
     void InitializeCattleBlackboard();
+
+    /** Refresh area blackboard values when the controlled animal enters or leaves an area */
+    UFUNCTION()
+    void HandleAreaTransition(ACattleAnimal *Animal, ACattleAreaBase *Area);
 };
@@ -0,0 +1,21 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "BTService_CattleBase.h"
+#include "AIController.h"
+#include "CattleGame/Animals/CattleAnimal.h"
+
+void UBTService_CattleBase::ScheduleNextTick(UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory)
+{
+    float IntervalScale = 1.0f;
+    if (const AAIController *AIController = OwnerComp.GetAIOwner())
+    {
+        if (const ACattleAnimal *Animal = Cast<ACattleAnimal>(AIController->GetPawn()))
+        {
+            IntervalScale = Animal->GetSignificanceIntervalScale();
+        }
+    }
+
+    const float ScaledInterval = Interval * IntervalScale;
+    const float ScaledDeviation = RandomDeviation * IntervalScale;
+    SetNextTickTime(NodeMemory, FMath::FRandRange(FMath::Max(0.0f, ScaledInterval - ScaledDeviation), ScaledInterval + ScaledDeviation));
+}
@@ -0,0 +1,23 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/BTService.h"
+#include "BTService_CattleBase.generated.h"
+
+/**
+ * UBTService_CattleBase
+ *
+ * Base for cattle behavior services. Stretches Interval and RandomDeviation by
+ * the controlled animal's significance interval scale, so distant cattle run
+ * their services less often.
+ */
+UCLASS(Abstract)
+class CATTLEGAME_API UBTService_CattleBase : public UBTService
+{
+    GENERATED_BODY()
+
+protected:
+    virtual void ScheduleNextTick(UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory) override;
+};
@@ -4,20 +4,31 @@
 #include "AIController.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "CattleGame/Animals/CattleAnimal.h"
-#include "GameFramework/Character.h"
-#include "Kismet/GameplayStatics.h"
+#include "CattleGame/Animals/Perception/CattlePerceptionSubsystem.h"
 
 UBTService_CheckNearbyThreats::UBTService_CheckNearbyThreats()
 {
     NodeName = "Check Nearby Threats";
     Interval = 0.25f;
     RandomDeviation = 0.05f;
+    bNotifyBecomeRelevant = true;
 
     NearestThreatKey.AddObjectFilter(this, GET_MEMBER_NAME_CHECKED(UBTService_CheckNearbyThreats, NearestThreatKey), AActor::StaticClass());
     ThreatDistanceKey.AddFloatFilter(this, GET_MEMBER_NAME_CHECKED(UBTService_CheckNearbyThreats, ThreatDistanceKey));
     IsBeingLuredKey.AddBoolFilter(this, GET_MEMBER_NAME_CHECKED(UBTService_CheckNearbyThreats, IsBeingLuredKey));
 }
 
+void UBTService_CheckNearbyThreats::OnBecomeRelevant(UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory)
+{
+    Super::OnBecomeRelevant(OwnerComp, NodeMemory);
+
+    // Perception scans once for every service, so it has to reach the widest one
+    if (UCattlePerceptionSubsystem *PerceptionSubsystem = OwnerComp.GetWorld()->GetSubsystem<UCattlePerceptionSubsystem>())
+    {
+        PerceptionSubsystem->RequestThreatRadius(ThreatDetectionRadius);
+    }
+}
+
 void UBTService_CheckNearbyThreats::TickNode(UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory, float DeltaSeconds)
 {
     Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
@@ -40,14 +51,34 @@ void UBTService_CheckNearbyThreats::TickNode(UBehaviorTreeComponent &OwnerComp,
         return;
     }
 
-    // Find nearest threat
-    AActor *NearestThreat = FindNearestThreat(AIController);
+    const UCattlePerceptionSubsystem *PerceptionSubsystem = Animal->GetWorld()->GetSubsystem<UCattlePerceptionSubsystem>();
+    const FCattlePerception *Perception = PerceptionSubsystem ? PerceptionSubsystem->GetPerception(Animal) : nullptr;
+    if (!Perception)
+    {
+        return;
+    }
+
+    // Nearest threat this node cares about, as of the animal's last perception refresh
+    AActor *NearestThreat = nullptr;
     float ThreatDistance = ThreatDetectionRadius + 1.0f;
 
-    if (NearestThreat)
+    for (const FCattlePerceivedThreat &Threat : Perception->Threats)
     {
-        ThreatDistance = FVector::Dist(Animal->GetActorLocation(), NearestThreat->GetActorLocation());
+        if (Threat.Distance > ThreatDetectionRadius)
+        {
+            break;
+        }
 
+        if (IsThreat(Threat))
+        {
+            NearestThreat = Threat.Actor.Get();
+            ThreatDistance = Threat.Distance;
+            break;
+        }
+    }
+
+    if (NearestThreat)
+    {
         // Add fear based on proximity (skip if being lured)
         bool bIsBeingLured = false;
         if (IsBeingLuredKey.SelectedKeyName != NAME_None)
@@ -75,81 +106,27 @@ void UBTService_CheckNearbyThreats::TickNode(UBehaviorTreeComponent &OwnerComp,
     }
 }
 
-AActor *UBTService_CheckNearbyThreats::FindNearestThreat(AAIController *AIController) const
+bool UBTService_CheckNearbyThreats::IsThreat(const FCattlePerceivedThreat &Threat) const
 {
-    APawn *Pawn = AIController->GetPawn();
-    if (!Pawn)
-    {
-        return nullptr;
-    }
-
-    UWorld *World = Pawn->GetWorld();
-    if (!World)
+    const AActor *Actor = Threat.Actor.Get();
+    if (!Actor)
     {
-        return nullptr;
+        return false;
     }
 
-    const FVector PawnLocation = Pawn->GetActorLocation();
-    AActor *NearestThreat = nullptr;
-    float NearestDistance = ThreatDetectionRadius;
-
-    // Check players if enabled
-    if (bPlayersAreThreat)
+    if (bPlayersAreThreat && Threat.Type == ECattleThreatType::Player)
     {
-        TArray<AActor *> PlayerPawns;
-        UGameplayStatics::GetAllActorsOfClass(World, ACharacter::StaticClass(), PlayerPawns);
-
-        for (AActor *PlayerPawn : PlayerPawns)
-        {
-            // Skip if it's another cattle animal
-            if (PlayerPawn->IsA(ACattleAnimal::StaticClass()))
-            {
-                continue;
-            }
-
-            // Skip if it's the same pawn
-            if (PlayerPawn == Pawn)
-            {
-                continue;
-            }
-
-            const float Distance = FVector::Dist(PawnLocation, PlayerPawn->GetActorLocation());
-            if (Distance < NearestDistance)
-            {
-                NearestDistance = Distance;
-                NearestThreat = PlayerPawn;
-            }
-        }
+        return true;
     }
 
-    // Check configured threat classes
     for (const TSubclassOf<AActor> &ThreatClass : ThreatClasses)
     {
-        if (!ThreatClass)
-        {
-            continue;
-        }
-
-        TArray<AActor *> ThreatActors;
-        UGameplayStatics::GetAllActorsOfClass(World, ThreatClass, ThreatActors);
-
-        for (AActor *ThreatActor : ThreatActors)
+        if (ThreatClass && Actor->IsA(ThreatClass))
         {
-            if (ThreatActor == Pawn)
-            {
-                continue;
-            }
-
-            const float Distance = FVector::Dist(PawnLocation, ThreatActor->GetActorLocation());
-            if (Distance < NearestDistance)
-            {
-                NearestDistance = Distance;
-                NearestThreat = ThreatActor;
-            }
+            return true;
         }
     }
-
-    return NearestThreat;
+    return false;
 }
 
 FString UBTService_CheckNearbyThreats::GetStaticDescription() const
@@ -3,17 +3,20 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "BehaviorTree/BTService.h"
+#include "BTService_CattleBase.h"
 #include "BTService_CheckNearbyThreats.generated.h"
 
+struct FCattlePerceivedThreat;
+
 /**
  * UBTService_CheckNearbyThreats
  *
- * Service that scans for nearby threats (players, predators) and updates blackboard.
- * Can add fear to the animal based on threat proximity.
+ * Copies the nearest threat perceived by UCattlePerceptionSubsystem that
+ * passes this node's filter (radius, players, threat classes) to the
+ * blackboard. Can add fear to the animal based on threat proximity.
  */
 UCLASS()
-class CATTLEGAME_API UBTService_CheckNearbyThreats : public UBTService
+class CATTLEGAME_API UBTService_CheckNearbyThreats : public UBTService_CattleBase
 {
     GENERATED_BODY()
 
@@ -24,6 +27,8 @@ public:
     virtual FString GetStaticDescription() const override;
 
 protected:
+    virtual void OnBecomeRelevant(UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory) override;
+
     /** Key to store the nearest threat actor */
     UPROPERTY(EditAnywhere, Category = "Blackboard")
     FBlackboardKeySelector NearestThreatKey;
@@ -48,7 +53,7 @@ protected:
     UPROPERTY(EditAnywhere, Category = "Threat Detection", meta = (ClampMin = "100.0"))
     float FearStartDistance = 1000.0f;
 
-    /** Actor classes considered threats */
+    /** Registered threat classes considered threats (actors register via UCattleThreatComponent) */
     UPROPERTY(EditAnywhere, Category = "Threat Detection")
     TArray<TSubclassOf<AActor>> ThreatClasses;
 
@@ -56,6 +61,6 @@ protected:
     UPROPERTY(EditAnywhere, Category = "Threat Detection")
     bool bPlayersAreThreat = true;
 
-    /** Find the nearest threat actor */
-    AActor *FindNearestThreat(AAIController *AIController) const;
+    /** Whether a perceived threat passes this node's filter */
+    bool IsThreat(const FCattlePerceivedThreat &Threat) const;
 };
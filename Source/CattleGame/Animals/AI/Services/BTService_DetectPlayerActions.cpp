@@ -3,15 +3,8 @@
 #include "BTService_DetectPlayerActions.h"
 #include "AIController.h"
 #include "BehaviorTree/BlackboardComponent.h"
-#include "Engine/OverlapResult.h"
 #include "CattleGame/Animals/CattleAnimal.h"
-#include "CattleGame/Weapons/Dynamite/DynamiteProjectile.h"
-#include "CattleGame/Weapons/Trumpet/Trumpet.h"
-#include "CattleGame/Weapons/Revolver/Revolver.h"
-#include "CattleGame/Character/CattleCharacter.h"
-#include "CattleGame/Character/InventoryComponent.h"
-#include "GameFramework/Character.h"
-#include "Kismet/GameplayStatics.h"
+#include "CattleGame/Animals/Perception/CattlePerceptionSubsystem.h"
 
 UBTService_DetectPlayerActions::UBTService_DetectPlayerActions()
 {
@@ -51,109 +44,26 @@ void UBTService_DetectPlayerActions::TickNode(UBehaviorTreeComponent &OwnerComp,
         return;
     }
 
-    // Detect all player actions
-    DetectNearbyExplosives(OwnerComp, Animal, BlackboardComp);
-    DetectTrumpetEffects(OwnerComp, Animal, BlackboardComp);
-    DetectPlayerShooting(OwnerComp, Animal, BlackboardComp);
-}
-
-void UBTService_DetectPlayerActions::DetectNearbyExplosives(UBehaviorTreeComponent &OwnerComp, ACattleAnimal *Animal, UBlackboardComponent *BlackboardComp)
-{
-    if (NearbyExplosiveKey.SelectedKeyName == NAME_None)
+    const UCattlePerceptionSubsystem *PerceptionSubsystem = Animal->GetWorld()->GetSubsystem<UCattlePerceptionSubsystem>();
+    const FCattlePerception *Perception = PerceptionSubsystem ? PerceptionSubsystem->GetPerception(Animal) : nullptr;
+    if (!Perception)
     {
         return;
     }
 
-    AActor *NearestExplosive = nullptr;
-    float NearestDistance = ExplosiveDetectionRadius;
-
-    // Find all dynamite projectiles in range
-    TArray<AActor *> FoundProjectiles;
-    UGameplayStatics::GetAllActorsOfClass(Animal->GetWorld(), ADynamiteProjectile::StaticClass(), FoundProjectiles);
-
-    const FVector AnimalLocation = Animal->GetActorLocation();
-
-    for (AActor *Projectile : FoundProjectiles)
-    {
-        ADynamiteProjectile *Dynamite = Cast<ADynamiteProjectile>(Projectile);
-        if (!Dynamite)
-        {
-            continue;
-        }
-
-        // Only detect fusing dynamite (not flying)
-        if (Dynamite->GetProjectileState() != EDynamiteState::Fusing)
-        {
-            continue;
-        }
-
-        const float Distance = FVector::Dist(AnimalLocation, Dynamite->GetActorLocation());
-        if (Distance < NearestDistance)
-        {
-            NearestDistance = Distance;
-            NearestExplosive = Dynamite;
-        }
-    }
+    AActor *NearestExplosive = Perception->NearestExplosive.Get();
+    AActor *LurerActor = Perception->Lurer.Get();
+    AActor *ScarerActor = Perception->Scarer.Get();
+    AActor *ShooterActor = Perception->Shooter.Get();
 
-    BlackboardComp->SetValueAsObject(NearbyExplosiveKey.SelectedKeyName, NearestExplosive);
-}
-
-void UBTService_DetectPlayerActions::DetectTrumpetEffects(UBehaviorTreeComponent &OwnerComp, ACattleAnimal *Animal, UBlackboardComponent *BlackboardComp)
-{
-    bool bIsLured = false;
-    bool bIsScared = false;
-    AActor *LurerActor = nullptr;
-    AActor *ScarerActor = nullptr;
-
-    const FVector AnimalLocation = Animal->GetActorLocation();
-
-    // Find all player characters and check if they're using trumpets
-    TArray<AActor *> FoundCharacters;
-    UGameplayStatics::GetAllActorsOfClass(Animal->GetWorld(), ACattleCharacter::StaticClass(), FoundCharacters);
-
-    for (AActor *CharacterActor : FoundCharacters)
+    // Update blackboard
+    if (NearbyExplosiveKey.SelectedKeyName != NAME_None)
     {
-        ACattleCharacter *Character = Cast<ACattleCharacter>(CharacterActor);
-        if (!Character)
-        {
-            continue;
-        }
-
-        const float Distance = FVector::Dist(AnimalLocation, Character->GetActorLocation());
-        if (Distance > TrumpetDetectionRadius)
-        {
-            continue;
-        }
-
-        // Check if character has trumpet equipped and playing
-        UInventoryComponent *Inventory = Character->GetInventoryComponent();
-        if (!Inventory)
-        {
-            continue;
-        }
-
-        ATrumpet *Trumpet = Cast<ATrumpet>(Inventory->GetEquippedWeapon());
-        if (!Trumpet || !Trumpet->IsPlaying())
-        {
-            continue;
-        }
-
-        if (Trumpet->IsPlayingLure())
-        {
-            bIsLured = true;
-            LurerActor = Character;
-        }
-        else
-        {
-            bIsScared = true;
-            ScarerActor = Character;
-        }
+        BlackboardComp->SetValueAsObject(NearbyExplosiveKey.SelectedKeyName, NearestExplosive);
     }
-
-    // Update blackboard
     if (IsBeingLuredKey.SelectedKeyName != NAME_None)
     {
-        BlackboardComp->SetValueAsBool(IsBeingLuredKey.SelectedKeyName, bIsLured);
+        BlackboardComp->SetValueAsBool(IsBeingLuredKey.SelectedKeyName, LurerActor != nullptr);
     }
     if (LurerActorKey.SelectedKeyName != NAME_None)
     {
@@ -161,68 +71,15 @@ void UBTService_DetectPlayerActions::DetectTrumpetEffects(UBehaviorTreeComponent
     }
     if (IsBeingScaredKey.SelectedKeyName != NAME_None)
     {
-        BlackboardComp->SetValueAsBool(IsBeingScaredKey.SelectedKeyName, bIsScared);
+        BlackboardComp->SetValueAsBool(IsBeingScaredKey.SelectedKeyName, ScarerActor != nullptr);
     }
     if (ScarerActorKey.SelectedKeyName != NAME_None)
     {
         BlackboardComp->SetValueAsObject(ScarerActorKey.SelectedKeyName, ScarerActor);
     }
-}
-
-void UBTService_DetectPlayerActions::DetectPlayerShooting(UBehaviorTreeComponent &OwnerComp, ACattleAnimal *Animal, UBlackboardComponent *BlackboardComp)
-{
-    bool bPlayerShooting = false;
-    AActor *ShooterActor = nullptr;
-
-    const FVector AnimalLocation = Animal->GetActorLocation();
-
-    // Find all player characters and check if they're shooting
-    TArray<AActor *> FoundCharacters;
-    UGameplayStatics::GetAllActorsOfClass(Animal->GetWorld(), ACattleCharacter::StaticClass(), FoundCharacters);
-
-    const float CurrentTime = Animal->GetWorld()->GetTimeSeconds();
-
-    for (AActor *CharacterActor : FoundCharacters)
-    {
-        ACattleCharacter *Character = Cast<ACattleCharacter>(CharacterActor);
-        if (!Character)
-        {
-            continue;
-        }
-
-        const float Distance = FVector::Dist(AnimalLocation, Character->GetActorLocation());
-        if (Distance > GunshotDetectionRadius)
-        {
-            continue;
-        }
-
-        // Check if character has revolver equipped and recently fired
-        UInventoryComponent *Inventory = Character->GetInventoryComponent();
-        if (!Inventory)
-        {
-            continue;
-        }
-
-        ARevolver *Revolver = Cast<ARevolver>(Inventory->GetEquippedWeapon());
-        if (!Revolver)
-        {
-            continue;
-        }
-
-        // Check if fired recently (within memory time)
-        const float TimeSinceLastFire = CurrentTime - Revolver->LastFireTime;
-        if (TimeSinceLastFire < GunshotMemoryTime && Revolver->LastFireTime > 0.0f)
-        {
-            bPlayerShooting = true;
-            ShooterActor = Character;
-            break;
-        }
-    }
-
-    // Update blackboard
     if (IsPlayerShootingKey.SelectedKeyName != NAME_None)
     {
-        BlackboardComp->SetValueAsBool(IsPlayerShootingKey.SelectedKeyName, bPlayerShooting);
+        BlackboardComp->SetValueAsBool(IsPlayerShootingKey.SelectedKeyName, ShooterActor != nullptr);
     }
     if (ShooterActorKey.SelectedKeyName != NAME_None)
     {
@@ -3,21 +3,22 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "BehaviorTree/BTService.h"
+#include "BTService_CattleBase.h"
 #include "BehaviorTree/BehaviorTreeTypes.h"
 #include "BTService_DetectPlayerActions.generated.h"
 
 /**
  * BTService_DetectPlayerActions
  *
- * Detects player actions affecting cattle and updates blackboard keys:
+ * Copies the player actions perceived by UCattlePerceptionSubsystem to
+ * blackboard keys:
  * - Nearby explosives (dynamite)
  * - Trumpet lure/scare effects
  * - Player shooting nearby
  * - Direct gunshot hits
  */
 UCLASS()
-class CATTLEGAME_API UBTService_DetectPlayerActions : public UBTService
+class CATTLEGAME_API UBTService_DetectPlayerActions : public UBTService_CattleBase
 {
     GENERATED_BODY()
 
@@ -57,27 +58,4 @@ protected:
     /** Actor key - the player shooting */
     UPROPERTY(EditAnywhere, Category = "Blackboard")
     FBlackboardKeySelector ShooterActorKey;
-
-    // ===== DETECTION SETTINGS =====
-
-    /** Radius to detect nearby explosives */
-    UPROPERTY(EditAnywhere, Category = "Detection|Explosive")
-    float ExplosiveDetectionRadius = 800.0f;
-
-    /** Radius to detect trumpet effects */
-    UPROPERTY(EditAnywhere, Category = "Detection|Trumpet")
-    float TrumpetDetectionRadius = 1500.0f;
-
-    /** Radius to detect gunshots */
-    UPROPERTY(EditAnywhere, Category = "Detection|Shooting")
-    float GunshotDetectionRadius = 1500.0f;
-
-    /** Time after last gunshot to still consider "shooting" */
-    UPROPERTY(EditAnywhere, Category = "Detection|Shooting")
-    float GunshotMemoryTime = 2.0f;
-
-private:
-    void DetectNearbyExplosives(UBehaviorTreeComponent &OwnerComp, class ACattleAnimal *Animal, class UBlackboardComponent *BlackboardComp);
-    void DetectTrumpetEffects(UBehaviorTreeComponent &OwnerComp, class ACattleAnimal *Animal, class UBlackboardComponent *BlackboardComp);
-    void DetectPlayerShooting(UBehaviorTreeComponent &OwnerComp, class ACattleAnimal *Animal, class UBlackboardComponent *BlackboardComp);
 };
@@ -5,7 +5,7 @@
 #include "BehaviorTree/BlackboardComponent.h"
 #include "CattleGame/Animals/CattleAnimal.h"
 #include "CattleGame/Animals/CattleAnimalMovementComponent.h"
-#include "NavigationSystem.h"
+#include "CattleGame/Animals/Navigation/CattleNavQuerySubsystem.h"
 
 UBTTask_CattleFlee::UBTTask_CattleFlee()
 {
@@ -30,6 +30,9 @@ EBTNodeResult::Type UBTTask_CattleFlee::ExecuteTask(UBehaviorTreeComponent &Owne
         return EBTNodeResult::Failed;
     }
 
+    FBTFleeTaskMemory *Memory = reinterpret_cast<FBTFleeTaskMemory *>(NodeMemory);
+    Memory->ProjectionRequestId = 0;
+
     UBlackboardComponent *BlackboardComp = OwnerComp.GetBlackboardComponent();
     if (!BlackboardComp)
     {
@@ -79,22 +82,50 @@ EBTNodeResult::Type UBTTask_CattleFlee::ExecuteTask(UBehaviorTreeComponent &Owne
     }
 
     // Calculate target location
-    FVector TargetLocation = Animal->GetActorLocation() + FleeDirection * FleeDistance;
+    const FVector TargetLocation = Animal->GetActorLocation() + FleeDirection * FleeDistance;
 
-    // Try to project to navigation
-    UNavigationSystemV1 *NavSys = UNavigationSystemV1::GetCurrent(GetWorld());
-    if (NavSys)
+    UCattleNavQuerySubsystem *NavQuerySubsystem = GetWorld()->GetSubsystem<UCattleNavQuerySubsystem>();
+    if (!NavQuerySubsystem)
     {
-        FNavLocation NavLocation;
-        if (NavSys->ProjectPointToNavigation(TargetLocation, NavLocation, FVector(500.0f, 500.0f, 500.0f)))
-        {
-            TargetLocation = NavLocation.Location;
-        }
+        BlackboardComp->SetValueAsVector(TargetLocationKey.SelectedKeyName, TargetLocation);
+        return EBTNodeResult::Succeeded;
     }
 
-    BlackboardComp->SetValueAsVector(TargetLocationKey.SelectedKeyName, TargetLocation);
+    // Project to navigation; the raw target is used when projection fails
+    Memory->ProjectionRequestId = NavQuerySubsystem->RequestProjection(
+        MakeArrayView(&TargetLocation, 1),
+        FOnCattleNavProjectionComplete::CreateWeakLambda(this, [this, TargetLocation, WeakOwnerComp = TWeakObjectPtr<UBehaviorTreeComponent>(&OwnerComp)](bool bSuccess, const FVector &Location)
+                                                         {
+            UBehaviorTreeComponent *OwnerComp = WeakOwnerComp.Get();
+            if (!OwnerComp)
+            {
+                return;
+            }
+
+            if (UBlackboardComponent *BlackboardComp = OwnerComp->GetBlackboardComponent())
+            {
+                BlackboardComp->SetValueAsVector(TargetLocationKey.SelectedKeyName, bSuccess ? Location : TargetLocation);
+            }
+            FinishLatentTask(*OwnerComp, EBTNodeResult::Succeeded); }));
+
+    return EBTNodeResult::InProgress;
+}
 
-    return EBTNodeResult::Succeeded;
+EBTNodeResult::Type UBTTask_CattleFlee::AbortTask(UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory)
+{
+    FBTFleeTaskMemory *Memory = reinterpret_cast<FBTFleeTaskMemory *>(NodeMemory);
+    if (UCattleNavQuerySubsystem *NavQuerySubsystem = GetWorld()->GetSubsystem<UCattleNavQuerySubsystem>())
+    {
+        NavQuerySubsystem->CancelRequest(Memory->ProjectionRequestId);
+    }
+    Memory->ProjectionRequestId = 0;
+
+    return EBTNodeResult::Aborted;
+}
+
+uint16 UBTTask_CattleFlee::GetInstanceMemorySize() const
+{
+    return sizeof(FBTFleeTaskMemory);
 }
 
 FString UBTTask_CattleFlee::GetStaticDescription() const
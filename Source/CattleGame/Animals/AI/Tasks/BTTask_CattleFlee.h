@@ -11,6 +11,9 @@
  *
  * Task that makes the cattle flee from a threat or in a direction.
  * Uses area influence direction or flees from a target actor.
+ *
+ * The flee target is projected to the navmesh through
+ * UCattleNavQuerySubsystem, so the task finishes on a later frame.
  */
 UCLASS()
 class CATTLEGAME_API UBTTask_CattleFlee : public UBTTaskNode
@@ -21,6 +24,8 @@ public:
     UBTTask_CattleFlee();
 
     virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory) override;
+    virtual EBTNodeResult::Type AbortTask(UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory) override;
+    virtual uint16 GetInstanceMemorySize() const override;
     virtual FString GetStaticDescription() const override;
 
 protected:
@@ -44,3 +49,10 @@ protected:
     UPROPERTY(EditAnywhere, Category = "Flee", meta = (ClampMin = "0.0", ClampMax = "45.0"))
     float RandomAngleVariation = 15.0f;
 };
+
+/** Memory struct for flee task */
+struct FBTFleeTaskMemory
+{
+    /** Pending navmesh projection, 0 when none */
+    uint32 ProjectionRequestId;
+};
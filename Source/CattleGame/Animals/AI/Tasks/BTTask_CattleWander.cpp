@@ -3,7 +3,7 @@
 #include "BTTask_CattleWander.h"
 #include "AIController.h"
 #include "BehaviorTree/BlackboardComponent.h"
-#include "NavigationSystem.h"
+#include "CattleGame/Animals/Navigation/CattleNavQuerySubsystem.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogCattleWander, Log, All);
 
@@ -31,6 +31,9 @@ EBTNodeResult::Type UBTTask_CattleWander::ExecuteTask(UBehaviorTreeComponent &Ow
         return EBTNodeResult::Failed;
     }
 
+    FBTWanderTaskMemory *Memory = reinterpret_cast<FBTWanderTaskMemory *>(NodeMemory);
+    Memory->ProjectionRequestId = 0;
+
     UBlackboardComponent *BlackboardComp = OwnerComp.GetBlackboardComponent();
     if (!BlackboardComp)
     {
@@ -46,11 +49,9 @@ EBTNodeResult::Type UBTTask_CattleWander::ExecuteTask(UBehaviorTreeComponent &Ow
     UE_LOG(LogCattleWander, Log, TEXT("[CattleWander] HomeLocation: %s, WanderRadius: %.1f, CurrentLocation: %s"),
            *HomeLocation.ToString(), WanderRadius, *CurrentLocation.ToString());
 
-    FVector TargetLocation = FVector::ZeroVector;
-    bool bFoundLocation = false;
-
-    // Try to find a valid wander location
-    for (int32 Attempt = 0; Attempt < 10; ++Attempt)
+    // Pick candidate points; navigation decides which of them are usable
+    TArray<FVector, TInlineAllocator<10>> Candidates;
+    for (int32 Attempt = 0; Attempt < MaxWanderAttempts; ++Attempt)
     {
         // Random point within wander radius of home
         const float RandomAngle = FMath::FRand() * 2.0f * PI;
@@ -70,49 +71,65 @@ EBTNodeResult::Type UBTTask_CattleWander::ExecuteTask(UBehaviorTreeComponent &Ow
             continue;
         }
 
-        if (bUseNavigation)
-        {
-            // Project to navigation
-            UNavigationSystemV1 *NavSys = UNavigationSystemV1::GetCurrent(GetWorld());
-            if (NavSys)
+        Candidates.Add(TestLocation);
+    }
+
+    if (Candidates.Num() == 0)
+    {
+        UE_LOG(LogCattleWander, Warning, TEXT("[CattleWander] FAILED - No wander candidate far enough after %d attempts"), MaxWanderAttempts);
+        return EBTNodeResult::Failed;
+    }
+
+    UCattleNavQuerySubsystem *NavQuerySubsystem = GetWorld()->GetSubsystem<UCattleNavQuerySubsystem>();
+    if (!bUseNavigation || !NavQuerySubsystem)
+    {
+        BlackboardComp->SetValueAsVector(TargetLocationKey.SelectedKeyName, Candidates[0]);
+        UE_LOG(LogCattleWander, Log, TEXT("[CattleWander] SUCCESS - Set target to: %s"), *Candidates[0].ToString());
+        return EBTNodeResult::Succeeded;
+    }
+
+    Memory->ProjectionRequestId = NavQuerySubsystem->RequestProjection(
+        Candidates,
+        FOnCattleNavProjectionComplete::CreateWeakLambda(this, [this, WeakOwnerComp = TWeakObjectPtr<UBehaviorTreeComponent>(&OwnerComp)](bool bSuccess, const FVector &Location)
+                                                         {
+            UBehaviorTreeComponent *OwnerComp = WeakOwnerComp.Get();
+            if (!OwnerComp)
+            {
+                return;
+            }
+
+            if (!bSuccess)
             {
-                FNavLocation NavLocation;
-                if (NavSys->ProjectPointToNavigation(TestLocation, NavLocation, FVector(500.0f, 500.0f, 500.0f)))
-                {
-                    TargetLocation = NavLocation.Location;
-                    bFoundLocation = true;
-                    UE_LOG(LogCattleWander, Log, TEXT("[CattleWander] Found location at attempt %d: %s"),
-                           Attempt, *TargetLocation.ToString());
-                    break;
-                }
-                else
-                {
-                    UE_LOG(LogCattleWander, Verbose, TEXT("[CattleWander] Attempt %d: Nav projection failed for %s"),
-                           Attempt, *TestLocation.ToString());
-                }
+                UE_LOG(LogCattleWander, Warning, TEXT("[CattleWander] FAILED - No wander candidate projected to navigation"));
+                FinishLatentTask(*OwnerComp, EBTNodeResult::Failed);
+                return;
             }
-            else
+
+            if (UBlackboardComponent *BlackboardComp = OwnerComp->GetBlackboardComponent())
             {
-                UE_LOG(LogCattleWander, Warning, TEXT("[CattleWander] No NavigationSystem found"));
+                BlackboardComp->SetValueAsVector(TargetLocationKey.SelectedKeyName, Location);
             }
-        }
-        else
-        {
-            TargetLocation = TestLocation;
-            bFoundLocation = true;
-            break;
-        }
-    }
+            UE_LOG(LogCattleWander, Log, TEXT("[CattleWander] SUCCESS - Set target to: %s"), *Location.ToString());
+            FinishLatentTask(*OwnerComp, EBTNodeResult::Succeeded); }));
 
-    if (bFoundLocation)
+    return EBTNodeResult::InProgress;
+}
+
+EBTNodeResult::Type UBTTask_CattleWander::AbortTask(UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory)
+{
+    FBTWanderTaskMemory *Memory = reinterpret_cast<FBTWanderTaskMemory *>(NodeMemory);
+    if (UCattleNavQuerySubsystem *NavQuerySubsystem = GetWorld()->GetSubsystem<UCattleNavQuerySubsystem>())
     {
-        BlackboardComp->SetValueAsVector(TargetLocationKey.SelectedKeyName, TargetLocation);
-        UE_LOG(LogCattleWander, Log, TEXT("[CattleWander] SUCCESS - Set target to: %s"), *TargetLocation.ToString());
-        return EBTNodeResult::Succeeded;
+        NavQuerySubsystem->CancelRequest(Memory->ProjectionRequestId);
     }
+    Memory->ProjectionRequestId = 0;
 
-    UE_LOG(LogCattleWander, Warning, TEXT("[CattleWander] FAILED - Could not find valid wander location after 10 attempts"));
-    return EBTNodeResult::Failed;
+    return EBTNodeResult::Aborted;
+}
+
+uint16 UBTTask_CattleWander::GetInstanceMemorySize() const
+{
+    return sizeof(FBTWanderTaskMemory);
 }
 
 FString UBTTask_CattleWander::GetStaticDescription() const
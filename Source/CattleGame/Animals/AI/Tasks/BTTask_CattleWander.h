@@ -11,6 +11,9 @@
  *
  * Task that makes the cattle wander to a random location within range.
  * Uses the HomeLocation and WanderRadius from blackboard.
+ *
+ * Candidate points are projected to the navmesh through
+ * UCattleNavQuerySubsystem, so the task finishes on a later frame.
  */
 UCLASS()
 class CATTLEGAME_API UBTTask_CattleWander : public UBTTaskNode
@@ -21,6 +24,8 @@ public:
     UBTTask_CattleWander();
 
     virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory) override;
+    virtual EBTNodeResult::Type AbortTask(UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory) override;
+    virtual uint16 GetInstanceMemorySize() const override;
     virtual FString GetStaticDescription() const override;
 
 protected:
@@ -43,4 +48,15 @@ protected:
     /** Whether to use navigation system for valid points */
     UPROPERTY(EditAnywhere, Category = "Wander")
     bool bUseNavigation = true;
+
+    /** Random points tried per wander */
+    UPROPERTY(EditAnywhere, Category = "Wander", meta = (ClampMin = "1", ClampMax = "10"))
+    int32 MaxWanderAttempts = 10;
+};
+
+/** Memory struct for wander task */
+struct FBTWanderTaskMemory
+{
+    /** Pending navmesh projection, 0 when none */
+    uint32 ProjectionRequestId;
 };
@@ -3,7 +3,7 @@
 #include "BTTask_FleeFromActor.h"
 #include "AIController.h"
 #include "BehaviorTree/BlackboardComponent.h"
-#include "NavigationSystem.h"
+#include "CattleGame/Animals/Navigation/CattleNavQuerySubsystem.h"
 
 UBTTask_FleeFromActor::UBTTask_FleeFromActor()
 {
@@ -27,6 +27,9 @@ EBTNodeResult::Type UBTTask_FleeFromActor::ExecuteTask(UBehaviorTreeComponent &O
         return EBTNodeResult::Failed;
     }
 
+    FBTFleeFromActorTaskMemory *Memory = reinterpret_cast<FBTFleeFromActorTaskMemory *>(NodeMemory);
+    Memory->ProjectionRequestId = 0;
+
     UBlackboardComponent *BlackboardComp = OwnerComp.GetBlackboardComponent();
     if (!BlackboardComp)
     {
@@ -62,26 +65,50 @@ EBTNodeResult::Type UBTTask_FleeFromActor::ExecuteTask(UBehaviorTreeComponent &O
     }
 
     // Calculate target location
-    FVector TargetLocation = PawnLocation + (FleeDirection * FleeDistance);
+    const FVector TargetLocation = PawnLocation + (FleeDirection * FleeDistance);
 
-    // Project to navigation if enabled
-    if (bUseNavigation)
+    UCattleNavQuerySubsystem *NavQuerySubsystem = GetWorld()->GetSubsystem<UCattleNavQuerySubsystem>();
+    if (!bUseNavigation || !NavQuerySubsystem)
     {
-        UNavigationSystemV1 *NavSys = UNavigationSystemV1::GetCurrent(GetWorld());
-        if (NavSys)
-        {
-            FNavLocation NavLocation;
-            if (NavSys->ProjectPointToNavigation(TargetLocation, NavLocation, FVector(500.0f, 500.0f, 500.0f)))
+        BlackboardComp->SetValueAsVector(TargetLocationKey.SelectedKeyName, TargetLocation);
+        return EBTNodeResult::Succeeded;
+    }
+
+    // Project to navigation; the raw target is used when projection fails
+    Memory->ProjectionRequestId = NavQuerySubsystem->RequestProjection(
+        MakeArrayView(&TargetLocation, 1),
+        FOnCattleNavProjectionComplete::CreateWeakLambda(this, [this, TargetLocation, WeakOwnerComp = TWeakObjectPtr<UBehaviorTreeComponent>(&OwnerComp)](bool bSuccess, const FVector &Location)
+                                                         {
+            UBehaviorTreeComponent *OwnerComp = WeakOwnerComp.Get();
+            if (!OwnerComp)
             {
-                TargetLocation = NavLocation.Location;
+                return;
             }
-        }
+
+            if (UBlackboardComponent *BlackboardComp = OwnerComp->GetBlackboardComponent())
+            {
+                BlackboardComp->SetValueAsVector(TargetLocationKey.SelectedKeyName, bSuccess ? Location : TargetLocation);
+            }
+            FinishLatentTask(*OwnerComp, EBTNodeResult::Succeeded); }));
+
+    return EBTNodeResult::InProgress;
+}
+
+EBTNodeResult::Type UBTTask_FleeFromActor::AbortTask(UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory)
+{
+    FBTFleeFromActorTaskMemory *Memory = reinterpret_cast<FBTFleeFromActorTaskMemory *>(NodeMemory);
+    if (UCattleNavQuerySubsystem *NavQuerySubsystem = GetWorld()->GetSubsystem<UCattleNavQuerySubsystem>())
+    {
+        NavQuerySubsystem->CancelRequest(Memory->ProjectionRequestId);
     }
+    Memory->ProjectionRequestId = 0;
 
-    // Set target location in blackboard
-    BlackboardComp->SetValueAsVector(TargetLocationKey.SelectedKeyName, TargetLocation);
+    return EBTNodeResult::Aborted;
+}
 
-    return EBTNodeResult::Succeeded;
+uint16 UBTTask_FleeFromActor::GetInstanceMemorySize() const
+{
+    return sizeof(FBTFleeFromActorTaskMemory);
 }
 
 FString UBTTask_FleeFromActor::GetStaticDescription() const
@@ -12,6 +12,8 @@
  *
  * Sets TargetLocation to flee away from a blackboard actor.
  * Used for fleeing from dynamite, trumpet scare, shooter, etc.
+ * With navigation the target is projected through UCattleNavQuerySubsystem,
+ * so the task finishes on a later frame.
  */
 UCLASS()
 class CATTLEGAME_API UBTTask_FleeFromActor : public UBTTaskNode
@@ -22,6 +24,8 @@ public:
     UBTTask_FleeFromActor();
 
     virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory) override;
+    virtual EBTNodeResult::Type AbortTask(UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory) override;
+    virtual uint16 GetInstanceMemorySize() const override;
     virtual FString GetStaticDescription() const override;
 
 protected:
@@ -45,3 +49,10 @@ protected:
     UPROPERTY(EditAnywhere, Category = "Flee")
     bool bUseNavigation = true;
 };
+
+/** Memory struct for flee from actor task */
+struct FBTFleeFromActorTaskMemory
+{
+    /** Pending navmesh projection, 0 when none */
+    uint32 ProjectionRequestId;
+};
@@ -2,6 +2,7 @@
 
 #include "CattleAreaBase.h"
 #include "CattleAreaSubsystem.h"
+#include "CattleAreaStats.h"
 #include "Components/SplineComponent.h"
 #include "Components/BoxComponent.h"
 #include "DrawDebugHelpers.h"
@@ -36,20 +37,45 @@ ACattleAreaBase::ACattleAreaBase()
 void ACattleAreaBase::BeginPlay()
 {
     Super::BeginPlay();
+
+    // Bake the distance field up front rather than on the first animal query
+    WarmShapeCaches();
+
+    // Static areas can still be moved (SetActorLocation, attachment); they re-index and rebake when they do
+    if (SceneRoot)
+    {
+        SceneRoot->TransformUpdated.AddUObject(this, &ACattleAreaBase::OnAreaTransformUpdated);
+    }
+
     RegisterWithSubsystem();
 }
 
 void ACattleAreaBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+    if (SceneRoot)
+    {
+        SceneRoot->TransformUpdated.RemoveAll(this);
+    }
+
     UnregisterFromSubsystem();
     Super::EndPlay(EndPlayReason);
 }
 
+void ACattleAreaBase::OnConstruction(const FTransform &Transform)
+{
+    Super::OnConstruction(Transform);
+
+    // Spline points may have been edited
+    SplinePolygon.Invalidate();
+}
+
 #if WITH_EDITOR
 void ACattleAreaBase::PostEditChangeProperty(FPropertyChangedEvent &PropertyChangedEvent)
 {
     Super::PostEditChangeProperty(PropertyChangedEvent);
 
+    SplinePolygon.Invalidate();
+
     // Update component visibility based on shape mode
     if (SplineComponent)
     {
@@ -60,64 +86,89 @@ void ACattleAreaBase::PostEditChangeProperty(FPropertyChangedEvent &PropertyChan
         BoxComponent->SetVisibility(!bUseSplineShape);
         BoxComponent->SetBoxExtent(FVector(BoxComponent->GetUnscaledBoxExtent().X, BoxComponent->GetUnscaledBoxExtent().Y, AreaHeight * 0.5f));
     }
+
+    // Keep the spatial index in sync when an area is edited while registered
+    if (UCattleAreaSubsystem *Subsystem = GetAreaSubsystem())
+    {
+        Subsystem->UpdateAreaBounds(this);
+    }
 }
 #endif
 
 bool ACattleAreaBase::IsLocationInArea(const FVector &Location) const
 {
-    // Check height first
-    const float ZMin = GetActorLocation().Z - AreaHeight * 0.5f;
-    const float ZMax = GetActorLocation().Z + AreaHeight * 0.5f;
-    if (Location.Z < ZMin || Location.Z > ZMax)
+    const FCattleAreaShape Shape = GetShape();
+    if (Shape.Polygon)
     {
-        return false;
+        CountSplineEvaluation();
     }
 
-    if (bUseSplineShape)
+    return GetInfluenceParams().Affects(Shape, Location);
+}
+
+FCattleAreaInfluence ACattleAreaBase::GetInfluenceAtLocation(const FVector &Location) const
+{
+    const FCattleAreaShape Shape = GetShape();
+    if (Shape.Polygon)
     {
-        return IsInsideSplineArea(Location);
+        CountSplineEvaluation();
     }
-    else
+
+    FCattleAreaInfluence Influence;
+    if (GetInfluenceParams().Evaluate(Shape, Location, Influence))
     {
-        // Use box bounds
-        if (BoxComponent)
-        {
-            const FVector LocalLocation = BoxComponent->GetComponentTransform().InverseTransformPosition(Location);
-            const FVector Extent = BoxComponent->GetUnscaledBoxExtent();
-            return FMath::Abs(LocalLocation.X) <= Extent.X &&
-                   FMath::Abs(LocalLocation.Y) <= Extent.Y &&
-                   FMath::Abs(LocalLocation.Z) <= Extent.Z;
-        }
+        Influence.AreaActor = const_cast<ACattleAreaBase *>(this);
     }
 
-    return false;
+    return Influence;
 }
 
-FCattleAreaInfluence ACattleAreaBase::GetInfluenceAtLocation(const FVector &Location) const
+FVector ACattleAreaBase::GetInfluenceDirection(const FVector &Location) const
 {
-    FCattleAreaInfluence Influence;
-
-    if (!IsLocationInArea(Location))
+    const FCattleAreaShape Shape = GetShape();
+    if (Shape.Polygon)
     {
-        return Influence;
+        CountSplineEvaluation();
     }
 
-    Influence.AreaType = GetAreaType();
-    Influence.AreaActor = const_cast<ACattleAreaBase *>(this);
-    Influence.InfluenceDirection = GetInfluenceDirection(Location);
-    Influence.SpeedModifier = GetSpeedModifier();
-    Influence.Priority = Priority + static_cast<int32>(GetAreaType()); // Add area type to priority for proper ordering
-
-    const float DistToBoundary = GetDistanceToBoundary(Location);
-    Influence.Strength = CalculateInfluenceStrength(DistToBoundary);
+    return GetInfluenceParams().GetDirection(Shape, Location);
+}
 
-    return Influence;
+FCattleAreaInfluenceParams ACattleAreaBase::GetInfluenceParams() const
+{
+    FCattleAreaInfluenceParams Params;
+    Params.AreaType = static_cast<uint8>(GetAreaType());
+    Params.Priority = GetEffectivePriority();
+    Params.SpeedModifier = GetSpeedModifier();
+    Params.EdgeFalloff = EdgeFalloff;
+    return Params;
 }
 
-FVector ACattleAreaBase::GetInfluenceDirection(const FVector &Location) const
+FBox2D ACattleAreaBase::GetAreaBounds2D() const
 {
-    // Default: no direction (override in subclasses)
-    return FVector::ZeroVector;
+    FBox2D Bounds(ForceInit);
+
+    if (bUseSplineShape && SplineComponent)
+    {
+        Bounds = GetSplinePolygon().GetBounds();
+    }
+    else if (BoxComponent)
+    {
+        const FTransform &BoxTransform = BoxComponent->GetComponentTransform();
+        const FVector Extent = BoxComponent->GetUnscaledBoxExtent();
+
+        for (int32 Corner = 0; Corner < 8; ++Corner)
+        {
+            const FVector LocalCorner(
+                (Corner & 1) ? Extent.X : -Extent.X,
+                (Corner & 2) ? Extent.Y : -Extent.Y,
+                (Corner & 4) ? Extent.Z : -Extent.Z);
+            Bounds += FVector2D(BoxTransform.TransformPosition(LocalCorner));
+        }
+    }
+
+    // Small margin so points exactly on the edge are not lost to float error
+    return Bounds.bIsValid ? Bounds.ExpandBy(1.0f + GetInfluenceReachBeyondShape()) : Bounds;
 }
 
 void ACattleAreaBase::DrawDebugArea(float Duration) const
@@ -145,103 +196,125 @@ void ACattleAreaBase::DrawDebugArea(float Duration) const
     }
 }
 
-float ACattleAreaBase::GetDistanceToBoundary(const FVector &Location) const
+const FCattleAreaPolygon &ACattleAreaBase::GetSplinePolygon() const
+{
+    SplinePolygon.Update(SplineComponent);
+    return SplinePolygon;
+}
+
+void ACattleAreaBase::GetHeightRange(float &OutMinZ, float &OutMaxZ) const
 {
+    OutMinZ = GetActorLocation().Z - AreaHeight * 0.5f;
+    OutMaxZ = GetActorLocation().Z + AreaHeight * 0.5f;
+}
+
+FCattleAreaShape ACattleAreaBase::GetShape() const
+{
+    FCattleAreaShape Shape;
+
     if (bUseSplineShape && SplineComponent)
     {
-        // Find closest point on spline and calculate distance
-        const FVector ClosestPoint = SplineComponent->FindLocationClosestToWorldLocation(Location, ESplineCoordinateSpace::World);
-        const float Distance = FVector::Dist2D(Location, ClosestPoint);
+        Shape.Polygon = &GetSplinePolygon();
 
-        // Negative if inside (this is a simplification - proper polygon distance is more complex)
-        return IsInsideSplineArea(Location) ? -Distance : Distance;
+        // A moving polygon would rebake the field on every query; dynamic areas measure exactly
+        if (!bDynamicArea)
+        {
+            const float Margin = GetDistanceFieldMargin();
+            if (!SplineDistanceField.IsUpToDate(*Shape.Polygon, Margin))
+            {
+                SplineDistanceField.Build(*Shape.Polygon, Margin, DistanceFieldCellSize);
+            }
+            Shape.DistanceField = &SplineDistanceField;
+        }
     }
     else if (BoxComponent)
     {
-        // Distance to box boundary
-        const FVector LocalLocation = BoxComponent->GetComponentTransform().InverseTransformPosition(Location);
-        const FVector Extent = BoxComponent->GetUnscaledBoxExtent();
-
-        // Calculate how far inside/outside each axis
-        FVector Distances;
-        Distances.X = FMath::Abs(LocalLocation.X) - Extent.X;
-        Distances.Y = FMath::Abs(LocalLocation.Y) - Extent.Y;
-        Distances.Z = FMath::Abs(LocalLocation.Z) - Extent.Z;
-
-        // If all negative, we're inside - return most negative (deepest)
-        if (Distances.X < 0 && Distances.Y < 0 && Distances.Z < 0)
-        {
-            return FMath::Max3(Distances.X, Distances.Y, Distances.Z);
-        }
-
-        // Outside - return positive distance
-        return FVector(FMath::Max(0.0f, Distances.X), FMath::Max(0.0f, Distances.Y), FMath::Max(0.0f, Distances.Z)).Size();
+        Shape.bHasBox = true;
+        Shape.BoxTransform = BoxComponent->GetComponentTransform();
+        Shape.BoxExtent = BoxComponent->GetUnscaledBoxExtent();
     }
 
-    return 0.0f;
+    Shape.ActorLocation = GetActorLocation();
+    Shape.ActorForward = GetActorForwardVector();
+    GetHeightRange(Shape.MinZ, Shape.MaxZ);
+    Shape.ReachBeyondShape = GetInfluenceReachBeyondShape();
+
+    return Shape;
 }
 
-float ACattleAreaBase::CalculateInfluenceStrength(float DistanceToBoundary) const
+const FCattleAreaPolygon *ACattleAreaBase::GetShapePolygon() const
 {
-    if (DistanceToBoundary >= 0.0f)
-    {
-        // Outside the area
-        return 0.0f;
-    }
+    return (bUseSplineShape && SplineComponent) ? &GetSplinePolygon() : nullptr;
+}
 
-    // Inside the area
-    const float DistanceInside = -DistanceToBoundary;
+const UBoxComponent *ACattleAreaBase::GetShapeBox() const
+{
+    return bUseSplineShape ? nullptr : BoxComponent.Get();
+}
 
-    if (EdgeFalloff <= 0.0f)
+bool ACattleAreaBase::CanInfluenceCircle2D(const FVector2D &Center, float Radius) const
+{
+    const FCattleAreaShape Shape = GetShape();
+    if (Shape.Polygon)
     {
-        return 1.0f;
+        CountSplineEvaluation();
     }
 
-    // Linear falloff at edges
-    return FMath::Clamp(DistanceInside / EdgeFalloff, 0.0f, 1.0f);
+    return Shape.CanInfluenceCircle2D(Center, Radius);
 }
 
-bool ACattleAreaBase::IsInsideSplineArea(const FVector &Location) const
+float ACattleAreaBase::GetMembershipMargin(const FVector &Location) const
 {
-    if (!SplineComponent || SplineComponent->GetNumberOfSplinePoints() < 3)
-    {
-        return false;
-    }
+    float MinZ, MaxZ;
+    GetHeightRange(MinZ, MaxZ);
+    float Margin = FMath::Min(FMath::Abs(Location.Z - MinZ), FMath::Abs(Location.Z - MaxZ));
 
-    // Use ray casting algorithm to determine if point is inside closed spline polygon
-    // Cast a ray in the +X direction and count intersections
-    int32 Intersections = 0;
-    const int32 NumPoints = SplineComponent->GetNumberOfSplinePoints();
-    const float TestZ = Location.Z;
+    if (bUseSplineShape && SplineComponent)
+    {
+        CountSplineEvaluation();
 
-    // Sample the spline at regular intervals for better accuracy
-    const int32 SamplesPerSegment = 10;
-    const int32 TotalSamples = NumPoints * SamplesPerSegment;
+        FVector2D Gradient;
+        const float Distance = FCattleAreaDistanceField::ComputeExact(GetSplinePolygon(), FVector2D(Location), Gradient);
 
-    for (int32 i = 0; i < TotalSamples; ++i)
+        // Membership tests read the interpolated field, which can be off by up to a cell
+        const float FieldError = bDynamicArea ? 0.0f : SplineDistanceField.GetCellSize();
+        Margin = FMath::Min(Margin, FMath::Abs(Distance - GetMembershipDistance()) - FieldError);
+    }
+    else if (BoxComponent)
+    {
+        // Box distances are in unscaled local units
+        const float MinScale = BoxComponent->GetComponentScale().GetAbs().GetMin();
+        Margin = FMath::Min(Margin, FMath::Abs(GetShape().GetDistanceToBoundary(Location) - GetMembershipDistance()) * MinScale);
+    }
+    else
     {
-        const float T1 = static_cast<float>(i) / TotalSamples;
-        const float T2 = static_cast<float>(i + 1) / TotalSamples;
+        Margin = 0.0f;
+    }
 
-        const FVector P1 = SplineComponent->GetLocationAtTime(T1, ESplineCoordinateSpace::World, true);
-        const FVector P2 = SplineComponent->GetLocationAtTime(T2, ESplineCoordinateSpace::World, true);
+    return FMath::Max(Margin, 0.0f);
+}
 
-        // Check if edge crosses the horizontal ray from Location in +X direction
-        if ((P1.Y <= Location.Y && P2.Y > Location.Y) || (P2.Y <= Location.Y && P1.Y > Location.Y))
-        {
-            // Calculate X intersection
-            const float T = (Location.Y - P1.Y) / (P2.Y - P1.Y);
-            const float IntersectX = P1.X + T * (P2.X - P1.X);
+void ACattleAreaBase::WarmShapeCaches() const
+{
+    GetShape();
+}
 
-            if (IntersectX > Location.X)
-            {
-                Intersections++;
-            }
-        }
+void ACattleAreaBase::InvalidateAreaShape()
+{
+    SplinePolygon.Invalidate();
+
+    if (UCattleAreaSubsystem *Subsystem = GetAreaSubsystem())
+    {
+        Subsystem->UpdateAreaBounds(this);
     }
+}
 
-    // Odd number of intersections = inside
-    return (Intersections % 2) == 1;
+void ACattleAreaBase::OnAreaTransformUpdated(USceneComponent *UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+    if (UCattleAreaSubsystem *Subsystem = GetAreaSubsystem())
+    {
+        Subsystem->UpdateAreaBounds(this);
+    }
 }
 
 UCattleAreaSubsystem *ACattleAreaBase::GetAreaSubsystem() const
@@ -5,6 +5,10 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "CattleAreaSubsystem.h"
+#include "CattleAreaPolygon.h"
+#include "CattleAreaDistanceField.h"
+#include "CattleAreaShape.h"
+#include "CattleAreaInfluenceParams.h"
 #include "CattleAreaBase.generated.h"
 
 class USplineComponent;
@@ -48,24 +52,87 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cattle Area|Shape", meta = (ClampMin = "0.0"))
     float EdgeFalloff = 200.0f;
 
+    /** Cell size of the baked distance field used for spline shapes (grows for very large areas) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cattle Area|Shape", AdvancedDisplay, meta = (ClampMin = "10.0"))
+    float DistanceFieldCellSize = 50.0f;
+
+    /**
+     * Whether this area moves at runtime (attached to a player, spawned by an explosion, ...).
+     * Dynamic areas are re-indexed whenever they move, are never baked, and skip the spline
+     * distance field. Must be set before the area registers (BeginPlay).
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Cattle Area")
+    bool bDynamicArea = false;
+
     // ===== Area Queries =====
 
     /** Check if a world location is inside this area */
     UFUNCTION(BlueprintCallable, Category = "Cattle Area")
-    virtual bool IsLocationInArea(const FVector &Location) const;
+    bool IsLocationInArea(const FVector &Location) const;
 
     /** Get the influence this area has at a specific location */
     UFUNCTION(BlueprintCallable, Category = "Cattle Area")
-    virtual FCattleAreaInfluence GetInfluenceAtLocation(const FVector &Location) const;
+    FCattleAreaInfluence GetInfluenceAtLocation(const FVector &Location) const;
 
     /** Get the movement direction this area wants to impart at a location */
     UFUNCTION(BlueprintCallable, Category = "Cattle Area")
-    virtual FVector GetInfluenceDirection(const FVector &Location) const;
+    FVector GetInfluenceDirection(const FVector &Location) const;
 
     /** Get the speed modifier this area applies */
     UFUNCTION(BlueprintCallable, Category = "Cattle Area")
     virtual float GetSpeedModifier() const { return 1.0f; }
 
+    /** World-space XY bounds of every location this area can influence (used by the subsystem's spatial index) */
+    virtual FBox2D GetAreaBounds2D() const;
+
+    /** Registration slot in the area subsystem (invalid while unregistered) */
+    const FCattleAreaHandle &GetAreaHandle() const { return AreaHandle; }
+
+    /** Priority reported in this area's influences (Priority plus the area type's base priority) */
+    int32 GetEffectivePriority() const { return Priority + static_cast<int32>(GetAreaType()); }
+
+    // ===== Shape Access =====
+
+    /** Vertical range covered by this area */
+    void GetHeightRange(float &OutMinZ, float &OutMaxZ) const;
+
+    /** View of the area's current geometry, rebuilding lazily cached shape data first (game thread only) */
+    FCattleAreaShape GetShape() const;
+
+    /** Copy of the properties this area's influence is computed from (game thread only); subclasses add their own */
+    virtual FCattleAreaInfluenceParams GetInfluenceParams() const;
+
+    /** Cached spline polygon, or nullptr when the area uses its box shape */
+    const FCattleAreaPolygon *GetShapePolygon() const;
+
+    /** Box defining the area shape, or nullptr when the area uses its spline shape */
+    const UBoxComponent *GetShapeBox() const;
+
+    /** How far past the area's shape its influence reaches in world units (e.g. avoidance margins) */
+    virtual float GetInfluenceReachBeyondShape() const { return 0.0f; }
+
+    /** Whether influence can reach locations outside the area's shape */
+    bool InfluenceExtendsBeyondShape() const { return GetInfluenceReachBeyondShape() > 0.0f; }
+
+    /** Conservative XY test: false only if no location within Radius of Center can be influenced */
+    bool CanInfluenceCircle2D(const FVector2D &Center, float Radius) const;
+
+    /**
+     * Distance a location can move in any direction without entering or leaving this area's
+     * influence. Conservative; used to skip re-evaluating animals that provably stay put.
+     */
+    float GetMembershipMargin(const FVector &Location) const;
+
+    /** Whether influence at a location is stable enough to be baked into a grid (false for randomized directions) */
+    virtual bool CanBakeInfluence() const { return true; }
+
+    /** Build cached shape data now rather than on the first query */
+    void WarmShapeCaches() const;
+
+    /** Discard the cached spline polygon and re-index the area; call after editing spline points at runtime */
+    UFUNCTION(BlueprintCallable, Category = "Cattle Area")
+    void InvalidateAreaShape();
+
     // ===== Debug =====
 
     /** Draw debug visualization for this area */
@@ -83,6 +150,7 @@ public:
 protected:
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void OnConstruction(const FTransform &Transform) override;
 
 #if WITH_EDITOR
     virtual void PostEditChangeProperty(FPropertyChangedEvent &PropertyChangedEvent) override;
@@ -104,14 +172,14 @@ protected:
 
     // ===== Helper Functions =====
 
-    /** Get distance from location to area boundary (negative = inside) */
-    float GetDistanceToBoundary(const FVector &Location) const;
+    /** Value of FCattleAreaShape::GetDistanceToBoundary at which a location enters or leaves this area's influence */
+    virtual float GetMembershipDistance() const { return 0.0f; }
 
-    /** Calculate influence strength based on distance to boundary */
-    float CalculateInfluenceStrength(float DistanceToBoundary) const;
+    /** How far outside the shape the distance field must reach */
+    virtual float GetDistanceFieldMargin() const { return EdgeFalloff; }
 
-    /** Check if point is inside spline area */
-    bool IsInsideSplineArea(const FVector &Location) const;
+    /** Get the cached spline polygon, re-transforming it if the spline moved */
+    const FCattleAreaPolygon &GetSplinePolygon() const;
 
     /** Get the area subsystem */
     UCattleAreaSubsystem *GetAreaSubsystem() const;
@@ -121,4 +189,30 @@ protected:
 
     /** Unregister from area subsystem */
     void UnregisterFromSubsystem();
+
+    /** Re-index the area after its root moved */
+    void OnAreaTransformUpdated(USceneComponent *UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+private:
+    friend class UCattleAreaSubsystem;
+
+    /** Assigned by the subsystem on registration */
+    FCattleAreaHandle AreaHandle;
+
+    /** The registering subsystem's counters; spline evaluations count towards its world */
+    FCattleAreaFrameCounters *FrameCounters = nullptr;
+
+    void CountSplineEvaluation() const
+    {
+        if (FrameCounters)
+        {
+            FrameCounters->CountSplineEvaluation();
+        }
+    }
+
+    /** Tessellated spline shape, built lazily on first query */
+    mutable FCattleAreaPolygon SplinePolygon;
+
+    /** Distance field baked from SplinePolygon, rebuilt whenever the polygon changes */
+    mutable FCattleAreaDistanceField SplineDistanceField;
 };
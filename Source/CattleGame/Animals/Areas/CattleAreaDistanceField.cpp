@@ -0,0 +1,107 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleAreaDistanceField.h"
+#include "CattleAreaPolygon.h"
+
+void FCattleAreaDistanceField::Invalidate()
+{
+    Distances.Reset();
+    Gradients.Reset();
+    SizeX = 0;
+    SizeY = 0;
+    bBuilt = false;
+}
+
+bool FCattleAreaDistanceField::IsUpToDate(const FCattleAreaPolygon &Polygon, float Margin) const
+{
+    return bBuilt && SourceRevision == Polygon.GetRevision() && SourceMargin == Margin;
+}
+
+void FCattleAreaDistanceField::Build(const FCattleAreaPolygon &Polygon, float Margin, float DesiredCellSize)
+{
+    Invalidate();
+
+    bBuilt = true;
+    SourceRevision = Polygon.GetRevision();
+    SourceMargin = Margin;
+
+    if (!Polygon.IsValid())
+    {
+        return;
+    }
+
+    const FBox2D Region = Polygon.GetBounds().ExpandBy(FMath::Max(Margin, 0.0f));
+    const FVector2D RegionSize = Region.GetSize();
+
+    // Keep the requested cell size unless that would exceed MaxResolution samples on an axis
+    CellSize = FMath::Max3(DesiredCellSize, 1.0f, static_cast<float>(RegionSize.GetMax() / (MaxResolution - 1)));
+    SizeX = FMath::CeilToInt32(RegionSize.X / CellSize) + 1;
+    SizeY = FMath::CeilToInt32(RegionSize.Y / CellSize) + 1;
+    Origin = Region.Min;
+
+    Distances.SetNumUninitialized(SizeX * SizeY);
+    Gradients.SetNumUninitialized(SizeX * SizeY);
+
+    for (int32 Y = 0; Y < SizeY; ++Y)
+    {
+        for (int32 X = 0; X < SizeX; ++X)
+        {
+            const FVector2D SampleLocation = Origin + FVector2D(X, Y) * CellSize;
+
+            FVector2D Gradient;
+            const int32 SampleIndex = Y * SizeX + X;
+            Distances[SampleIndex] = ComputeExact(Polygon, SampleLocation, Gradient);
+            Gradients[SampleIndex] = FVector2f(Gradient);
+        }
+    }
+}
+
+bool FCattleAreaDistanceField::Sample(const FVector2D &Location, float &OutDistance, FVector2D &OutGradient) const
+{
+    if (SizeX < 2 || SizeY < 2)
+    {
+        return false;
+    }
+
+    const FVector2D GridLocation = (Location - Origin) / CellSize;
+    const int32 X0 = FMath::FloorToInt32(GridLocation.X);
+    const int32 Y0 = FMath::FloorToInt32(GridLocation.Y);
+
+    if (X0 < 0 || Y0 < 0 || X0 >= SizeX - 1 || Y0 >= SizeY - 1)
+    {
+        return false;
+    }
+
+    const float FracX = static_cast<float>(GridLocation.X - X0);
+    const float FracY = static_cast<float>(GridLocation.Y - Y0);
+
+    const int32 I00 = Y0 * SizeX + X0;
+    const int32 I10 = I00 + 1;
+    const int32 I01 = I00 + SizeX;
+    const int32 I11 = I01 + 1;
+
+    OutDistance = FMath::BiLerp(Distances[I00], Distances[I10], Distances[I01], Distances[I11], FracX, FracY);
+
+    const FVector2f Gradient = FMath::BiLerp(Gradients[I00], Gradients[I10], Gradients[I01], Gradients[I11], FracX, FracY);
+
+    // Gradients on opposite sides of a ridge cancel out; let the caller use the exact query there
+    if (Gradient.SizeSquared() < 0.25f)
+    {
+        return false;
+    }
+
+    OutGradient = FVector2D(Gradient.GetSafeNormal());
+    return true;
+}
+
+float FCattleAreaDistanceField::ComputeExact(const FCattleAreaPolygon &Polygon, const FVector2D &Location, FVector2D &OutGradient)
+{
+    FVector2D ClosestPoint;
+    const float Distance = Polygon.GetDistanceToEdge(Location, &ClosestPoint);
+    const bool bInside = Polygon.Contains(Location);
+
+    // Away from the boundary outside, toward it inside
+    OutGradient = (Location - ClosestPoint).GetSafeNormal() * (bInside ? -1.0 : 1.0);
+
+    return bInside ? -Distance : Distance;
+}
@@ -0,0 +1,61 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FCattleAreaPolygon;
+
+/**
+ * FCattleAreaDistanceField
+ *
+ * Baked 2D signed distance (negative inside) and outward gradient for an area
+ * polygon, covering the polygon bounds plus a margin. Queries inside the baked
+ * region are a single bilinear fetch; anything else falls back to the exact
+ * polygon distance.
+ */
+struct CATTLEGAME_API FCattleAreaDistanceField
+{
+public:
+    /** Upper bound on samples per axis; the cell size grows to stay within it */
+    static constexpr int32 MaxResolution = 128;
+
+    /** Drop the baked grid */
+    void Invalidate();
+
+    /** Whether the grid was baked from this polygon revision with this margin */
+    bool IsUpToDate(const FCattleAreaPolygon &Polygon, float Margin) const;
+
+    /** Bake the grid over the polygon bounds expanded by Margin */
+    void Build(const FCattleAreaPolygon &Polygon, float Margin, float DesiredCellSize);
+
+    /**
+     * Bilinear fetch of signed distance and unit outward gradient.
+     * Returns false outside the baked region or where the gradient is ambiguous (medial ridges).
+     */
+    bool Sample(const FVector2D &Location, float &OutDistance, FVector2D &OutGradient) const;
+
+    /** Spacing of the baked samples (0 before the first build) */
+    float GetCellSize() const { return CellSize; }
+
+    /** Exact signed distance and unit outward gradient, evaluated against every polygon edge */
+    static float ComputeExact(const FCattleAreaPolygon &Polygon, const FVector2D &Location, FVector2D &OutGradient);
+
+private:
+    /** World XY of sample (0, 0) */
+    FVector2D Origin = FVector2D::ZeroVector;
+
+    float CellSize = 0.0f;
+
+    int32 SizeX = 0;
+    int32 SizeY = 0;
+
+    /** Row-major samples, SizeX * SizeY */
+    TArray<float> Distances;
+    TArray<FVector2f> Gradients;
+
+    /** Inputs the grid was baked from */
+    uint32 SourceRevision = 0;
+    float SourceMargin = 0.0f;
+    bool bBuilt = false;
+};
@@ -0,0 +1,254 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleAreaInfluenceGrid.h"
+#include "CattleAreaBase.h"
+#include "CattleAreaSubsystem.h"
+
+void FCattleAreaInfluenceGrid::Reset(float InCellSize)
+{
+    if (InCellSize > 0.0f)
+    {
+        CellSize = FMath::Max(InCellSize, 1.0f);
+    }
+
+    Tiles.Reset();
+    DirtyTiles.Reset();
+}
+
+FIntPoint FCattleAreaInfluenceGrid::GetTileAtLocation(const FVector2D &Location) const
+{
+    const double TileSize = CellSize * CellsPerTile;
+    return FIntPoint(
+        FMath::FloorToInt32(Location.X / TileSize),
+        FMath::FloorToInt32(Location.Y / TileSize));
+}
+
+FBox2D FCattleAreaInfluenceGrid::GetTileBounds(const FIntPoint &TileCoord) const
+{
+    const double TileSize = CellSize * CellsPerTile;
+    const FVector2D Min(TileCoord.X * TileSize, TileCoord.Y * TileSize);
+    return FBox2D(Min, Min + FVector2D(TileSize, TileSize));
+}
+
+void FCattleAreaInfluenceGrid::MarkDirty(const FBox2D &Bounds)
+{
+    if (!Bounds.bIsValid)
+    {
+        return;
+    }
+
+    const FIntPoint MinTile = GetTileAtLocation(Bounds.Min);
+    const FIntPoint MaxTile = GetTileAtLocation(Bounds.Max);
+
+    ++DirtyGeneration;
+
+    for (int32 Y = MinTile.Y; Y <= MaxTile.Y; ++Y)
+    {
+        for (int32 X = MinTile.X; X <= MaxTile.X; ++X)
+        {
+            DirtyTiles.Add(FIntPoint(X, Y), DirtyGeneration);
+        }
+    }
+}
+
+void FCattleAreaInfluenceGrid::GetDirtyTiles(int32 MaxTiles, TArray<FIntPoint> &OutTileCoords) const
+{
+    OutTileCoords.Reset();
+
+    // Oldest first, so tiles under an area that moves every frame cannot starve the rest
+    TArray<TPair<FIntPoint, uint32>> Candidates = DirtyTiles.Array();
+    Candidates.Sort([](const TPair<FIntPoint, uint32> &A, const TPair<FIntPoint, uint32> &B)
+                    { return A.Value < B.Value; });
+
+    for (const TPair<FIntPoint, uint32> &Candidate : Candidates)
+    {
+        if (OutTileCoords.Num() >= MaxTiles)
+        {
+            break;
+        }
+        OutTileCoords.Add(Candidate.Key);
+    }
+}
+
+bool FCattleAreaInfluenceGrid::TryGetInfluence(const FVector &Location, FCattleAreaInfluence &OutInfluence) const
+{
+    const FIntPoint TileCoord = GetTileAtLocation(FVector2D(Location));
+
+    if (DirtyTiles.Contains(TileCoord))
+    {
+        return false;
+    }
+
+    const FCattleBakedAreaTile *Tile = Tiles.Find(TileCoord);
+    if (!Tile)
+    {
+        // Clean tiles without data have no areas
+        OutInfluence = FCattleAreaInfluence();
+        return true;
+    }
+
+    const FBox2D TileBounds = GetTileBounds(TileCoord);
+    const int32 CellX = FMath::Clamp(FMath::FloorToInt32((Location.X - TileBounds.Min.X) / CellSize), 0, CellsPerTile - 1);
+    const int32 CellY = FMath::Clamp(FMath::FloorToInt32((Location.Y - TileBounds.Min.Y) / CellSize), 0, CellsPerTile - 1);
+    const FCattleBakedAreaCell &Cell = Tile->Cells[CellY * CellsPerTile + CellX];
+
+    switch (Cell.State)
+    {
+    case ECattleBakedCellState::Empty:
+        OutInfluence = FCattleAreaInfluence();
+        return true;
+
+    case ECattleBakedCellState::Resolved:
+    {
+        if (Location.Z < Cell.MinZ || Location.Z > Cell.MaxZ)
+        {
+            return false;
+        }
+
+        const TWeakObjectPtr<ACattleAreaBase> &Area = Tile->Areas[Cell.AreaSlot];
+        if (!Area.IsValid())
+        {
+            return false;
+        }
+
+        OutInfluence.AreaType = static_cast<ECattleAreaType>(Cell.AreaType);
+        OutInfluence.AreaActor = Area;
+        OutInfluence.InfluenceDirection = FVector(Cell.Direction);
+        OutInfluence.SpeedModifier = Cell.SpeedModifier;
+        OutInfluence.Strength = Cell.Strength;
+        OutInfluence.Priority = Cell.Priority;
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+
+void FCattleAreaInfluenceGrid::ApplyBake(const FCattleAreaBakeBatch &Batch)
+{
+    for (const FCattleAreaBakeJob &Job : Batch.Jobs)
+    {
+        // An area changed under the tile while it was baking; it stays dirty for the next bake
+        const uint32 *Generation = DirtyTiles.Find(Job.TileCoord);
+        if (!Generation || *Generation != Job.DirtyGeneration)
+        {
+            continue;
+        }
+
+        DirtyTiles.Remove(Job.TileCoord);
+
+        if (Job.ResultSources.Num() == 0 && !Job.ResultCells.ContainsByPredicate([](const FCattleBakedAreaCell &Cell)
+                                                                                  { return Cell.State != ECattleBakedCellState::Empty; }))
+        {
+            Tiles.Remove(Job.TileCoord);
+            continue;
+        }
+
+        FCattleBakedAreaTile &Tile = Tiles.FindOrAdd(Job.TileCoord);
+        Tile.Cells = Job.ResultCells;
+        Tile.Areas.Reset(Job.ResultSources.Num());
+
+        for (const int32 SourceIndex : Job.ResultSources)
+        {
+            Tile.Areas.Add(Batch.Sources[SourceIndex].Area);
+        }
+    }
+}
+
+void FCattleAreaInfluenceGrid::BakeJob(const FCattleAreaBakeBatch &Batch, FCattleAreaBakeJob &Job)
+{
+    const float BakeCellSize = Batch.CellSize;
+    const double TileSize = BakeCellSize * CellsPerTile;
+    const FVector2D TileMin(Job.TileCoord.X * TileSize, Job.TileCoord.Y * TileSize);
+
+    // Cell center plus four points just inside the corners
+    const float CornerOffset = BakeCellSize * 0.49f;
+    const FVector2D SampleOffsets[] = {
+        FVector2D(0.0f, 0.0f),
+        FVector2D(-CornerOffset, -CornerOffset),
+        FVector2D(CornerOffset, -CornerOffset),
+        FVector2D(-CornerOffset, CornerOffset),
+        FVector2D(CornerOffset, CornerOffset)};
+
+    const float HalfDiagonal = BakeCellSize * UE_HALF_SQRT_2;
+
+    Job.ResultCells.Reset();
+    Job.ResultCells.SetNum(CellsPerTile * CellsPerTile);
+    Job.ResultSources.Reset();
+
+    // Views of the snapshots, in Job.SourceIndices order
+    TArray<FCattleAreaShape, TInlineAllocator<16>> Shapes;
+    for (const int32 SourceIndex : Job.SourceIndices)
+    {
+        Shapes.Add(Batch.Sources[SourceIndex].Shape.GetShape());
+    }
+
+    for (int32 CellY = 0; CellY < CellsPerTile; ++CellY)
+    {
+        for (int32 CellX = 0; CellX < CellsPerTile; ++CellX)
+        {
+            FCattleBakedAreaCell &Cell = Job.ResultCells[CellY * CellsPerTile + CellX];
+            const FVector2D CellCenter = TileMin + FVector2D(CellX + 0.5, CellY + 0.5) * BakeCellSize;
+            const FBox2D CellBounds(CellCenter - FVector2D(BakeCellSize * 0.5f), CellCenter + FVector2D(BakeCellSize * 0.5f));
+
+            // Sources are sorted by priority, so the first one that can reach the cell decides it
+            for (int32 JobSource = 0; JobSource < Job.SourceIndices.Num(); ++JobSource)
+            {
+                const int32 SourceIndex = Job.SourceIndices[JobSource];
+                const FCattleAreaBakeSource &Source = Batch.Sources[SourceIndex];
+                const FCattleAreaShape &Shape = Shapes[JobSource];
+
+                if (!Source.Bounds.Intersect(CellBounds) || !Shape.CanInfluenceCircle2D(CellCenter, HalfDiagonal))
+                {
+                    continue;
+                }
+
+                if (!Source.bCanBake)
+                {
+                    Cell.State = ECattleBakedCellState::Live;
+                    break;
+                }
+
+                const float SampleZ = (Source.MinZ + Source.MaxZ) * 0.5f;
+                FCattleAreaInfluence CenterInfluence;
+                bool bCoversCell = true;
+
+                for (int32 SampleIndex = 0; SampleIndex < UE_ARRAY_COUNT(SampleOffsets) && bCoversCell; ++SampleIndex)
+                {
+                    FCattleAreaInfluence Influence;
+                    bCoversCell = Source.Params.Evaluate(Shape, FVector(CellCenter + SampleOffsets[SampleIndex], SampleZ), Influence);
+
+                    if (SampleIndex == 0)
+                    {
+                        CenterInfluence = MoveTemp(Influence);
+                    }
+                }
+
+                int32 Slot = Job.ResultSources.Find(SourceIndex);
+                if (bCoversCell && Slot == INDEX_NONE && Job.ResultSources.Num() <= MAX_uint8)
+                {
+                    Slot = Job.ResultSources.Add(SourceIndex);
+                }
+
+                // Partial coverage (or a full palette) leaves the cell to live queries
+                if (!bCoversCell || Slot == INDEX_NONE)
+                {
+                    Cell.State = ECattleBakedCellState::Live;
+                    break;
+                }
+
+                Cell.State = ECattleBakedCellState::Resolved;
+                Cell.AreaSlot = static_cast<uint8>(Slot);
+                Cell.AreaType = static_cast<uint8>(CenterInfluence.AreaType);
+                Cell.Direction = FVector3f(CenterInfluence.InfluenceDirection);
+                Cell.Strength = CenterInfluence.Strength;
+                Cell.SpeedModifier = CenterInfluence.SpeedModifier;
+                Cell.Priority = CenterInfluence.Priority;
+                Cell.MinZ = Source.MinZ;
+                Cell.MaxZ = Source.MaxZ;
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,156 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CattleAreaInfluenceParams.h"
+
+class ACattleAreaBase;
+struct FCattleAreaInfluence;
+
+/** What a baked cell knows about the influence inside it */
+enum class ECattleBakedCellState : uint8
+{
+    /** No area can influence any location in the cell */
+    Empty,
+    /** One area covers the whole cell and wins over every other candidate */
+    Resolved,
+    /** The cell is ambiguous (partial coverage, randomized influence) and needs a live query */
+    Live
+};
+
+/** Baked primary influence for one grid cell, sampled at the cell center */
+struct FCattleBakedAreaCell
+{
+    FVector3f Direction = FVector3f::ZeroVector;
+    float Strength = 0.0f;
+    float SpeedModifier = 1.0f;
+
+    /** Height range of the resolved area; queries outside it need a live query */
+    float MinZ = 0.0f;
+    float MaxZ = 0.0f;
+
+    int32 Priority = 0;
+
+    /** Index into the owning tile's area list */
+    uint8 AreaSlot = 0;
+
+    /** ECattleAreaType of the resolved area */
+    uint8 AreaType = 0;
+
+    ECattleBakedCellState State = ECattleBakedCellState::Empty;
+};
+
+/** A square block of baked cells */
+struct FCattleBakedAreaTile
+{
+    TArray<FCattleBakedAreaCell> Cells;
+
+    /** Areas referenced by AreaSlot */
+    TArray<TWeakObjectPtr<ACattleAreaBase>> Areas;
+};
+
+/** Game-thread snapshot of an area used while baking */
+struct FCattleAreaBakeSource
+{
+    /** Area the baked cells refer to; never touched by the worker */
+    TWeakObjectPtr<ACattleAreaBase> Area;
+
+    /** Copies of the area's geometry and influence properties when the bake launched */
+    FCattleAreaShapeSnapshot Shape;
+    FCattleAreaInfluenceParams Params;
+
+    FBox2D Bounds = FBox2D(ForceInit);
+    float MinZ = 0.0f;
+    float MaxZ = 0.0f;
+
+    /** Registration slot index, used to break priority ties like the live query does */
+    int32 Order = 0;
+
+    bool bCanBake = true;
+};
+
+/** One tile to bake and its result */
+struct FCattleAreaBakeJob
+{
+    FIntPoint TileCoord = FIntPoint::ZeroValue;
+
+    /** Dirty generation of the tile when the bake launched; a newer one discards the result */
+    uint32 DirtyGeneration = 0;
+
+    /** Indices into FCattleAreaBakeBatch::Sources, highest priority first */
+    TArray<int32> SourceIndices;
+
+    /** Baked cells; AreaSlot indexes ResultSources */
+    TArray<FCattleBakedAreaCell> ResultCells;
+    TArray<int32> ResultSources;
+};
+
+/** Work handed to a background bake task */
+struct FCattleAreaBakeBatch
+{
+    float CellSize = 100.0f;
+    TArray<FCattleAreaBakeSource> Sources;
+    TArray<FCattleAreaBakeJob> Jobs;
+};
+
+/**
+ * FCattleAreaInfluenceGrid
+ *
+ * World-aligned grid of pre-resolved primary area influences, stored in
+ * square tiles that are only allocated where areas exist. Tiles touched by an
+ * area change are marked dirty and answer with a live query until their
+ * rebake lands.
+ */
+class CATTLEGAME_API FCattleAreaInfluenceGrid
+{
+public:
+    /** Cells per tile edge */
+    static constexpr int32 CellsPerTile = 32;
+
+    /** Remove all tiles and optionally change the cell size */
+    void Reset(float InCellSize = 0.0f);
+
+    float GetCellSize() const { return CellSize; }
+
+    /** Tile coordinate containing a world XY location */
+    FIntPoint GetTileAtLocation(const FVector2D &Location) const;
+
+    /** World XY bounds of a tile */
+    FBox2D GetTileBounds(const FIntPoint &TileCoord) const;
+
+    /** Mark every tile overlapping the bounds for rebaking */
+    void MarkDirty(const FBox2D &Bounds);
+
+    /** Whether any tile is waiting to be rebaked */
+    bool HasDirtyTiles() const { return DirtyTiles.Num() > 0; }
+
+    /** Take up to MaxTiles dirty tiles, longest dirty first (they stay dirty until their result is applied) */
+    void GetDirtyTiles(int32 MaxTiles, TArray<FIntPoint> &OutTileCoords) const;
+
+    /** Generation in which a dirty tile was last marked dirty */
+    uint32 GetDirtyGeneration(const FIntPoint &TileCoord) const { return DirtyTiles.FindRef(TileCoord); }
+
+    /**
+     * Look up the baked primary influence.
+     * Returns false when the location must be answered by a live query.
+     */
+    bool TryGetInfluence(const FVector &Location, FCattleAreaInfluence &OutInfluence) const;
+
+    /** Store the results of a finished bake and clear those tiles' dirty flags, skipping tiles dirtied again since it launched */
+    void ApplyBake(const FCattleAreaBakeBatch &Batch);
+
+    /** Resolve every cell of a job; reads only the batch's snapshots, so it is safe to run off the game thread */
+    static void BakeJob(const FCattleAreaBakeBatch &Batch, FCattleAreaBakeJob &Job);
+
+private:
+    float CellSize = 100.0f;
+
+    TMap<FIntPoint, FCattleBakedAreaTile> Tiles;
+
+    /** Tiles whose baked data no longer matches the registered areas, and the generation they were last marked dirty in */
+    TMap<FIntPoint, uint32> DirtyTiles;
+
+    /** Bumped by every MarkDirty; never reset, so results of a running bake can always be told apart */
+    uint32 DirtyGeneration = 0;
+};
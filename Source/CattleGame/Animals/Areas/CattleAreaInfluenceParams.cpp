@@ -0,0 +1,250 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleAreaInfluenceParams.h"
+#include "CattleAreaSubsystem.h"
+
+namespace CattleAreaInfluence
+{
+    FVector GetRandomDirection()
+    {
+        const float RandomAngle = FMath::FRand() * 360.0f;
+        return FVector(FMath::Cos(FMath::DegreesToRadians(RandomAngle)), FMath::Sin(FMath::DegreesToRadians(RandomAngle)), 0.0f);
+    }
+
+    /** Direction toward the center of the area to encourage staying, only near edges */
+    FVector GetContainmentDirection(const FCattleAreaShape &Shape, float EdgeFalloff, const FVector &Location)
+    {
+        // Centroid of the spline points, or the box center
+        const FVector AreaCenter = Shape.GetCenter();
+
+        // Get distance to boundary
+        const float DistToBoundary = Shape.GetDistanceToBoundary(Location);
+
+        // Only apply containment force near edges (within falloff distance)
+        if (EdgeFalloff > 0.0f && DistToBoundary > -EdgeFalloff)
+        {
+            // Calculate strength based on how close to edge
+            const float EdgeProximity = 1.0f - FMath::Clamp(-DistToBoundary / EdgeFalloff, 0.0f, 1.0f);
+
+            // Direction toward center
+            FVector ToCenter = AreaCenter - Location;
+            ToCenter.Z = 0.0f; // Keep horizontal
+
+            return ToCenter.GetSafeNormal() * EdgeProximity;
+        }
+
+        return FVector::ZeroVector;
+    }
+
+    /** Direction away from the area center/threat */
+    FVector GetFleeDirection(const FCattleAreaShape &Shape, bool bRandomDirection, const FVector &Location)
+    {
+        if (bRandomDirection)
+        {
+            // Random direction for stampede chaos
+            return GetRandomDirection();
+        }
+
+        FVector FleeDir;
+
+        if (Shape.Polygon)
+        {
+            // Closest point on spline is the threat source; the distance field gives the direction away from it
+            FleeDir = Shape.GetPolygonBoundaryAwayDirection(Location);
+        }
+        else
+        {
+            const FVector ThreatCenter = Shape.GetCenter();
+
+            // Direction away from threat
+            FleeDir = Location - ThreatCenter;
+            FleeDir.Z = 0.0f; // Keep horizontal
+        }
+
+        // If at center, pick a random direction
+        if (FleeDir.IsNearlyZero())
+        {
+            return GetRandomDirection();
+        }
+
+        return FleeDir.GetSafeNormal();
+    }
+
+    /** Direction away from the area boundary */
+    FVector GetAvoidanceDirection(const FCattleAreaShape &Shape, const FVector &Location)
+    {
+        if (Shape.Polygon)
+        {
+            // One distance field fetch instead of a closest-point search
+            const FVector AwayDir = Shape.GetPolygonBoundaryAwayDirection(Location);
+            return AwayDir.IsNearlyZero() ? Shape.ActorForward : AwayDir;
+        }
+
+        FVector ClosestBoundaryPoint;
+
+        if (Shape.bHasBox)
+        {
+            // Find closest point on box surface
+            const FVector LocalLocation = Shape.BoxTransform.InverseTransformPosition(Location);
+            const FVector &Extent = Shape.BoxExtent;
+
+            // Clamp to box surface
+            FVector ClampedLocal;
+            ClampedLocal.X = FMath::Clamp(LocalLocation.X, -Extent.X, Extent.X);
+            ClampedLocal.Y = FMath::Clamp(LocalLocation.Y, -Extent.Y, Extent.Y);
+            ClampedLocal.Z = FMath::Clamp(LocalLocation.Z, -Extent.Z, Extent.Z);
+
+            // If inside, push to nearest face
+            if (LocalLocation.X >= -Extent.X && LocalLocation.X <= Extent.X &&
+                LocalLocation.Y >= -Extent.Y && LocalLocation.Y <= Extent.Y &&
+                LocalLocation.Z >= -Extent.Z && LocalLocation.Z <= Extent.Z)
+            {
+                // Find which face is closest
+                float MinDist = Extent.X - FMath::Abs(LocalLocation.X);
+                int32 ClosestAxis = 0;
+
+                if (Extent.Y - FMath::Abs(LocalLocation.Y) < MinDist)
+                {
+                    MinDist = Extent.Y - FMath::Abs(LocalLocation.Y);
+                    ClosestAxis = 1;
+                }
+                if (Extent.Z - FMath::Abs(LocalLocation.Z) < MinDist)
+                {
+                    ClosestAxis = 2;
+                }
+
+                // Move to closest face
+                switch (ClosestAxis)
+                {
+                case 0:
+                    ClampedLocal.X = (LocalLocation.X >= 0) ? Extent.X : -Extent.X;
+                    break;
+                case 1:
+                    ClampedLocal.Y = (LocalLocation.Y >= 0) ? Extent.Y : -Extent.Y;
+                    break;
+                case 2:
+                    ClampedLocal.Z = (LocalLocation.Z >= 0) ? Extent.Z : -Extent.Z;
+                    break;
+                }
+            }
+
+            ClosestBoundaryPoint = Shape.BoxTransform.TransformPosition(ClampedLocal);
+        }
+        else
+        {
+            ClosestBoundaryPoint = Shape.ActorLocation;
+        }
+
+        // Direction away from boundary
+        FVector AwayDir = Location - ClosestBoundaryPoint;
+        AwayDir.Z = 0.0f; // Keep horizontal
+
+        if (AwayDir.IsNearlyZero())
+        {
+            // At boundary center, push in a consistent direction
+            return Shape.ActorForward;
+        }
+
+        return AwayDir.GetSafeNormal();
+    }
+
+    /** Influence strength based on distance to boundary, fading in over EdgeFalloff */
+    float CalculateInfluenceStrength(float DistanceToBoundary, float EdgeFalloff)
+    {
+        if (DistanceToBoundary >= 0.0f)
+        {
+            // Outside the area
+            return 0.0f;
+        }
+
+        // Inside the area
+        const float DistanceInside = -DistanceToBoundary;
+
+        if (EdgeFalloff <= 0.0f)
+        {
+            return 1.0f;
+        }
+
+        // Linear falloff at edges
+        return FMath::Clamp(DistanceInside / EdgeFalloff, 0.0f, 1.0f);
+    }
+}
+
+bool FCattleAreaInfluenceParams::Affects(const FCattleAreaShape &Shape, const FVector &Location) const
+{
+    if (DirectionMode == ECattleAreaDirectionMode::Avoid)
+    {
+        // Inside the actual area or within avoidance radius outside
+        return Shape.GetDistanceToBoundary(Location) < AvoidanceRadius;
+    }
+
+    return Shape.Contains(Location);
+}
+
+bool FCattleAreaInfluenceParams::Evaluate(const FCattleAreaShape &Shape, const FVector &Location, FCattleAreaInfluence &OutInfluence) const
+{
+    using namespace CattleAreaInfluence;
+
+    if (DirectionMode == ECattleAreaDirectionMode::Avoid)
+    {
+        const float DistToBoundary = Shape.GetDistanceToBoundary(Location);
+
+        // Check if within avoidance range (including outside the boundary), then height
+        if (DistToBoundary >= AvoidanceRadius || Location.Z < Shape.MinZ || Location.Z > Shape.MaxZ)
+        {
+            return false;
+        }
+
+        OutInfluence.AreaType = static_cast<ECattleAreaType>(AreaType);
+        OutInfluence.InfluenceDirection = GetAvoidanceDirection(Shape, Location);
+        OutInfluence.Priority = Priority;
+
+        if (DistToBoundary < 0)
+        {
+            // Inside the area - full strength
+            OutInfluence.Strength = 1.0f;
+            OutInfluence.SpeedModifier = SpeedModifier;
+        }
+        else
+        {
+            // Outside but within avoidance radius - falloff
+            OutInfluence.Strength = 1.0f - (DistToBoundary / AvoidanceRadius);
+            OutInfluence.SpeedModifier = 1.0f; // Normal speed outside
+        }
+
+        return true;
+    }
+
+    if (!Shape.Contains(Location))
+    {
+        return false;
+    }
+
+    OutInfluence.AreaType = static_cast<ECattleAreaType>(AreaType);
+    OutInfluence.InfluenceDirection = GetDirection(Shape, Location);
+    OutInfluence.SpeedModifier = SpeedModifier;
+    OutInfluence.Priority = Priority;
+    OutInfluence.Strength = CalculateInfluenceStrength(Shape.GetDistanceToBoundary(Location), EdgeFalloff);
+
+    return true;
+}
+
+FVector FCattleAreaInfluenceParams::GetDirection(const FCattleAreaShape &Shape, const FVector &Location) const
+{
+    using namespace CattleAreaInfluence;
+
+    switch (DirectionMode)
+    {
+    case ECattleAreaDirectionMode::Contain:
+        return GetContainmentDirection(Shape, EdgeFalloff, Location) * DirectionStrength;
+
+    case ECattleAreaDirectionMode::Flee:
+        return GetFleeDirection(Shape, bRandomDirection, Location) * DirectionStrength;
+
+    case ECattleAreaDirectionMode::Avoid:
+        return GetAvoidanceDirection(Shape, Location) * DirectionStrength;
+
+    default:
+        return FVector::ZeroVector;
+    }
+}
@@ -0,0 +1,63 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CattleAreaShape.h"
+
+struct FCattleAreaInfluence;
+
+/** How an area turns its shape into an influence direction */
+enum class ECattleAreaDirectionMode : uint8
+{
+    /** No direction */
+    None,
+    /** Toward the shape's center, fading in within EdgeFalloff of the boundary */
+    Contain,
+    /** Away from the polygon boundary or the shape's center */
+    Flee,
+    /** Away from the closest boundary point; influence reaches AvoidanceRadius past the shape */
+    Avoid
+};
+
+/**
+ * FCattleAreaInfluenceParams
+ *
+ * Copy of the area properties its influence is computed from. Together with
+ * an FCattleAreaShape it fully determines the influence at a location, so the
+ * background bake evaluates copies of both and never touches the area actor.
+ */
+struct CATTLEGAME_API FCattleAreaInfluenceParams
+{
+    /** ECattleAreaType of the area */
+    uint8 AreaType = 0;
+
+    /** Priority reported in the influence (the area's effective priority) */
+    int32 Priority = 0;
+
+    float SpeedModifier = 1.0f;
+    float EdgeFalloff = 0.0f;
+
+    ECattleAreaDirectionMode DirectionMode = ECattleAreaDirectionMode::None;
+
+    /** Scale applied to the unit direction */
+    float DirectionStrength = 1.0f;
+
+    /** Flee: pick a new random direction on every query */
+    bool bRandomDirection = false;
+
+    /** Avoid: distance past the boundary, in GetDistanceToBoundary units, within which the area still influences */
+    float AvoidanceRadius = 0.0f;
+
+    /** Whether the location is in the area (Avoid: within AvoidanceRadius of it, at any height) */
+    bool Affects(const FCattleAreaShape &Shape, const FVector &Location) const;
+
+    /**
+     * Influence at a location; returns false if the area does not influence it.
+     * AreaActor is left to the caller.
+     */
+    bool Evaluate(const FCattleAreaShape &Shape, const FVector &Location, FCattleAreaInfluence &OutInfluence) const;
+
+    /** Direction the area imparts at a location, scaled by DirectionStrength */
+    FVector GetDirection(const FCattleAreaShape &Shape, const FVector &Location) const;
+};
@@ -0,0 +1,144 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleAreaPolygon.h"
+#include "Components/SplineComponent.h"
+
+void FCattleAreaPolygon::Invalidate()
+{
+    LocalVertices.Reset();
+    WorldVertices.Reset();
+    Bounds = FBox2D(ForceInit);
+    LocalPointCentroid = FVector::ZeroVector;
+    WorldPointCentroid = FVector::ZeroVector;
+    bTessellated = false;
+}
+
+void FCattleAreaPolygon::Update(const USplineComponent *Spline)
+{
+    if (!Spline)
+    {
+        Invalidate();
+        return;
+    }
+
+    const FTransform &ComponentTransform = Spline->GetComponentTransform();
+
+    if (!bTessellated)
+    {
+        LocalVertices.Reset();
+        LocalPointCentroid = FVector::ZeroVector;
+
+        const int32 NumPoints = Spline->GetNumberOfSplinePoints();
+        for (int32 i = 0; i < NumPoints; ++i)
+        {
+            LocalPointCentroid += Spline->GetLocationAtSplinePoint(i, ESplineCoordinateSpace::Local) / NumPoints;
+        }
+
+        if (NumPoints >= 3)
+        {
+            const int32 TotalSamples = NumPoints * SamplesPerSegment;
+            LocalVertices.Reserve(TotalSamples);
+
+            for (int32 i = 0; i < TotalSamples; ++i)
+            {
+                const float T = static_cast<float>(i) / TotalSamples;
+                LocalVertices.Add(Spline->GetLocationAtTime(T, ESplineCoordinateSpace::Local, true));
+            }
+        }
+
+        bTessellated = true;
+        TransformVertices(ComponentTransform);
+    }
+    else if (!ComponentTransform.Equals(CachedTransform))
+    {
+        TransformVertices(ComponentTransform);
+    }
+}
+
+void FCattleAreaPolygon::TransformVertices(const FTransform &Transform)
+{
+    CachedTransform = Transform;
+    Bounds = FBox2D(ForceInit);
+    WorldPointCentroid = Transform.TransformPosition(LocalPointCentroid);
+    ++Revision;
+
+    WorldVertices.Reset(LocalVertices.Num());
+    for (const FVector &LocalVertex : LocalVertices)
+    {
+        const FVector2D WorldVertex(Transform.TransformPosition(LocalVertex));
+        WorldVertices.Add(WorldVertex);
+        Bounds += WorldVertex;
+    }
+}
+
+bool FCattleAreaPolygon::Contains(const FVector2D &Point) const
+{
+    if (!IsValid() || !Bounds.IsInsideOrOn(Point))
+    {
+        return false;
+    }
+
+    // Cast a ray in the +X direction and count edge crossings
+    bool bInside = false;
+    const int32 NumVertices = WorldVertices.Num();
+
+    for (int32 i = 0, j = NumVertices - 1; i < NumVertices; j = i++)
+    {
+        const FVector2D &P1 = WorldVertices[j];
+        const FVector2D &P2 = WorldVertices[i];
+
+        if ((P1.Y <= Point.Y && P2.Y > Point.Y) || (P2.Y <= Point.Y && P1.Y > Point.Y))
+        {
+            const double T = (Point.Y - P1.Y) / (P2.Y - P1.Y);
+            const double IntersectX = P1.X + T * (P2.X - P1.X);
+
+            if (IntersectX > Point.X)
+            {
+                bInside = !bInside;
+            }
+        }
+    }
+
+    return bInside;
+}
+
+float FCattleAreaPolygon::GetDistanceToEdge(const FVector2D &Point, FVector2D *OutClosestPoint) const
+{
+    if (WorldVertices.Num() < 2)
+    {
+        if (OutClosestPoint)
+        {
+            *OutClosestPoint = Point;
+        }
+        return 0.0f;
+    }
+
+    double BestDistSq = TNumericLimits<double>::Max();
+    FVector2D BestPoint = WorldVertices[0];
+    const int32 NumVertices = WorldVertices.Num();
+
+    for (int32 i = 0, j = NumVertices - 1; i < NumVertices; j = i++)
+    {
+        const FVector2D &A = WorldVertices[j];
+        const FVector2D &B = WorldVertices[i];
+
+        const FVector2D Edge = B - A;
+        const double EdgeLengthSq = Edge.SizeSquared();
+        const double T = EdgeLengthSq > UE_SMALL_NUMBER ? FMath::Clamp(FVector2D::DotProduct(Point - A, Edge) / EdgeLengthSq, 0.0, 1.0) : 0.0;
+        const FVector2D Candidate = A + Edge * T;
+
+        const double DistSq = FVector2D::DistSquared(Point, Candidate);
+        if (DistSq < BestDistSq)
+        {
+            BestDistSq = DistSq;
+            BestPoint = Candidate;
+        }
+    }
+
+    if (OutClosestPoint)
+    {
+        *OutClosestPoint = BestPoint;
+    }
+
+    return static_cast<float>(FMath::Sqrt(BestDistSq));
+}
@@ -0,0 +1,77 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USplineComponent;
+
+/**
+ * FCattleAreaPolygon
+ *
+ * Cached 2D tessellation of a closed spline used for point-in-area tests.
+ *
+ * The spline is evaluated once into component-space samples. World-space
+ * vertices and their XY bounds are derived from those samples and only
+ * recomputed when the spline component's transform changes, so queries never
+ * evaluate the spline itself.
+ */
+struct CATTLEGAME_API FCattleAreaPolygon
+{
+public:
+    /** Spline samples taken per spline point when tessellating */
+    static constexpr int32 SamplesPerSegment = 10;
+
+    /** Drop all cached data so the next Update re-tessellates the spline */
+    void Invalidate();
+
+    /**
+     * Make sure the cached polygon matches the spline.
+     * Re-tessellates if invalidated, otherwise only re-transforms when the component moved.
+     */
+    void Update(const USplineComponent *Spline);
+
+    /** Whether the polygon has enough vertices to enclose an area */
+    bool IsValid() const { return WorldVertices.Num() >= 3; }
+
+    /** World-space XY vertices of the closed polygon */
+    const TArray<FVector2D> &GetVertices() const { return WorldVertices; }
+
+    /** World-space XY bounds of the polygon */
+    const FBox2D &GetBounds() const { return Bounds; }
+
+    /** World-space average of the spline's control points */
+    const FVector &GetPointCentroid() const { return WorldPointCentroid; }
+
+    /** Incremented whenever the world-space vertices change */
+    uint32 GetRevision() const { return Revision; }
+
+    /** Even-odd point-in-polygon test */
+    bool Contains(const FVector2D &Point) const;
+
+    /** Distance from a point to the nearest polygon edge, optionally returning the closest edge point */
+    float GetDistanceToEdge(const FVector2D &Point, FVector2D *OutClosestPoint = nullptr) const;
+
+private:
+    /** Rebuild world vertices and bounds from the local samples */
+    void TransformVertices(const FTransform &Transform);
+
+    /** Spline samples in component space */
+    TArray<FVector> LocalVertices;
+
+    /** Spline samples in world space (XY only) */
+    TArray<FVector2D> WorldVertices;
+
+    FBox2D Bounds = FBox2D(ForceInit);
+
+    /** Average of the spline points in component space and world space */
+    FVector LocalPointCentroid = FVector::ZeroVector;
+    FVector WorldPointCentroid = FVector::ZeroVector;
+
+    /** Component transform the world vertices were built with */
+    FTransform CachedTransform = FTransform::Identity;
+
+    uint32 Revision = 0;
+
+    bool bTessellated = false;
+};
@@ -0,0 +1,144 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleAreaShape.h"
+
+bool FCattleAreaShape::Contains(const FVector &Location) const
+{
+    // Check height first
+    if (Location.Z < MinZ || Location.Z > MaxZ)
+    {
+        return false;
+    }
+
+    if (Polygon)
+    {
+        return Polygon->Contains(FVector2D(Location));
+    }
+
+    if (bHasBox)
+    {
+        const FVector LocalLocation = BoxTransform.InverseTransformPosition(Location);
+        return FMath::Abs(LocalLocation.X) <= BoxExtent.X &&
+               FMath::Abs(LocalLocation.Y) <= BoxExtent.Y &&
+               FMath::Abs(LocalLocation.Z) <= BoxExtent.Z;
+    }
+
+    return false;
+}
+
+float FCattleAreaShape::GetDistanceToBoundary(const FVector &Location) const
+{
+    if (Polygon)
+    {
+        FVector2D Gradient;
+        return SamplePolygonDistance(Location, Gradient);
+    }
+
+    if (bHasBox)
+    {
+        // Distance to box boundary
+        const FVector LocalLocation = BoxTransform.InverseTransformPosition(Location);
+
+        // Calculate how far inside/outside each axis
+        FVector Distances;
+        Distances.X = FMath::Abs(LocalLocation.X) - BoxExtent.X;
+        Distances.Y = FMath::Abs(LocalLocation.Y) - BoxExtent.Y;
+        Distances.Z = FMath::Abs(LocalLocation.Z) - BoxExtent.Z;
+
+        // If all negative, we're inside - return most negative (deepest)
+        if (Distances.X < 0 && Distances.Y < 0 && Distances.Z < 0)
+        {
+            return FMath::Max3(Distances.X, Distances.Y, Distances.Z);
+        }
+
+        // Outside - return positive distance
+        return FVector(FMath::Max(0.0f, Distances.X), FMath::Max(0.0f, Distances.Y), FMath::Max(0.0f, Distances.Z)).Size();
+    }
+
+    return 0.0f;
+}
+
+float FCattleAreaShape::SamplePolygonDistance(const FVector &Location, FVector2D &OutGradient) const
+{
+    check(Polygon);
+
+    float Distance;
+    if (DistanceField && DistanceField->Sample(FVector2D(Location), Distance, OutGradient))
+    {
+        return Distance;
+    }
+
+    return FCattleAreaDistanceField::ComputeExact(*Polygon, FVector2D(Location), OutGradient);
+}
+
+FVector FCattleAreaShape::GetPolygonBoundaryAwayDirection(const FVector &Location) const
+{
+    FVector2D Gradient;
+    const float Distance = SamplePolygonDistance(Location, Gradient);
+
+    // The outward gradient points away from the boundary outside and toward it inside
+    return FVector(Gradient * FMath::Sign(Distance), 0.0f);
+}
+
+FVector FCattleAreaShape::GetCenter() const
+{
+    if (Polygon)
+    {
+        return Polygon->GetPointCentroid();
+    }
+
+    return bHasBox ? BoxTransform.GetLocation() : ActorLocation;
+}
+
+bool FCattleAreaShape::CanInfluenceCircle2D(const FVector2D &Center, float Radius) const
+{
+    const float Reach = Radius + ReachBeyondShape;
+
+    if (Polygon)
+    {
+        FVector2D Gradient;
+        return SamplePolygonDistance(FVector(Center, 0.0f), Gradient) <= Reach;
+    }
+
+    if (bHasBox)
+    {
+        // Distance from the circle center to the box footprint, measured in world units
+        const FVector LocalCenter = BoxTransform.InverseTransformPosition(FVector(Center, BoxTransform.GetLocation().Z));
+
+        const FVector ClampedLocal(
+            FMath::Clamp(LocalCenter.X, -BoxExtent.X, BoxExtent.X),
+            FMath::Clamp(LocalCenter.Y, -BoxExtent.Y, BoxExtent.Y),
+            LocalCenter.Z);
+
+        return FVector::Dist2D(BoxTransform.TransformPosition(ClampedLocal), FVector(Center, 0.0f)) <= Reach;
+    }
+
+    return false;
+}
+
+FCattleAreaShapeSnapshot::FCattleAreaShapeSnapshot(const FCattleAreaShape &Shape)
+    : Frame(Shape)
+{
+    Frame.Polygon = nullptr;
+    Frame.DistanceField = nullptr;
+
+    if (Shape.Polygon)
+    {
+        Polygon = *Shape.Polygon;
+        bHasPolygon = true;
+    }
+
+    if (Shape.DistanceField)
+    {
+        DistanceField = *Shape.DistanceField;
+        bHasDistanceField = true;
+    }
+}
+
+FCattleAreaShape FCattleAreaShapeSnapshot::GetShape() const
+{
+    FCattleAreaShape Shape = Frame;
+    Shape.Polygon = bHasPolygon ? &Polygon : nullptr;
+    Shape.DistanceField = bHasDistanceField ? &DistanceField : nullptr;
+    return Shape;
+}
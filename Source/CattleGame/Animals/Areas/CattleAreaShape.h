@@ -0,0 +1,84 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CattleAreaPolygon.h"
+#include "CattleAreaDistanceField.h"
+
+/**
+ * FCattleAreaShape
+ *
+ * World-space geometry an area's influence is computed from: a spline polygon
+ * (with its baked distance field) or a box, plus the actor frame and height
+ * range. Live queries get a view of the area's own caches; the background
+ * bake evaluates an FCattleAreaShapeSnapshot, so it never reads components or
+ * caches the game thread may be moving or invalidating.
+ */
+struct CATTLEGAME_API FCattleAreaShape
+{
+    /** Spline polygon, or nullptr for box shapes */
+    const FCattleAreaPolygon *Polygon = nullptr;
+
+    /** Distance field baked from Polygon, or nullptr to always measure exactly */
+    const FCattleAreaDistanceField *DistanceField = nullptr;
+
+    /** Box shape, used when there is no polygon */
+    bool bHasBox = false;
+    FTransform BoxTransform = FTransform::Identity;
+    FVector BoxExtent = FVector::ZeroVector;
+
+    FVector ActorLocation = FVector::ZeroVector;
+    FVector ActorForward = FVector::ForwardVector;
+
+    /** Vertical range covered by the area */
+    float MinZ = 0.0f;
+    float MaxZ = 0.0f;
+
+    /** How far past the shape the area's influence reaches */
+    float ReachBeyondShape = 0.0f;
+
+    /** Whether the location is within the height range and the polygon or box */
+    bool Contains(const FVector &Location) const;
+
+    /** Distance to the boundary (negative inside); XY for polygons, unscaled local units for boxes */
+    float GetDistanceToBoundary(const FVector &Location) const;
+
+    /** Signed XY distance to the polygon boundary and its unit outward gradient; requires Polygon */
+    float SamplePolygonDistance(const FVector &Location, FVector2D &OutGradient) const;
+
+    /** Direction from the closest polygon boundary point toward Location (zero if on the boundary); requires Polygon */
+    FVector GetPolygonBoundaryAwayDirection(const FVector &Location) const;
+
+    /** Center used for containment and flight: the spline points' centroid, the box center or the actor location */
+    FVector GetCenter() const;
+
+    /** Conservative XY test: false only if no location within Radius of Center can be influenced */
+    bool CanInfluenceCircle2D(const FVector2D &Center, float Radius) const;
+};
+
+/**
+ * FCattleAreaShapeSnapshot
+ *
+ * Owning copy of an area's shape, taken on the game thread. The copy is
+ * immutable, so it can be read from any thread while the area itself changes.
+ */
+struct CATTLEGAME_API FCattleAreaShapeSnapshot
+{
+public:
+    FCattleAreaShapeSnapshot() = default;
+    explicit FCattleAreaShapeSnapshot(const FCattleAreaShape &Shape);
+
+    /** View of the copied shape; valid while the snapshot is neither moved nor destroyed */
+    FCattleAreaShape GetShape() const;
+
+private:
+    /** Everything but the polygon and distance field pointers */
+    FCattleAreaShape Frame;
+
+    FCattleAreaPolygon Polygon;
+    FCattleAreaDistanceField DistanceField;
+
+    bool bHasPolygon = false;
+    bool bHasDistanceField = false;
+};
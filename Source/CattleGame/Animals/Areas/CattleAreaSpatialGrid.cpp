@@ -0,0 +1,226 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleAreaSpatialGrid.h"
+
+FCattleAreaSpatialGrid::FCattleAreaSpatialGrid(float InCellSize)
+    : CellSize(FMath::Max(InCellSize, 1.0f))
+{
+}
+
+void FCattleAreaSpatialGrid::Reset(float InCellSize)
+{
+    if (InCellSize > 0.0f)
+    {
+        CellSize = FMath::Max(InCellSize, 1.0f);
+    }
+
+    Cells.Reset();
+    OversizedItems.Reset();
+    Items.Reset();
+}
+
+FIntPoint FCattleAreaSpatialGrid::GetCellAtLocation(const FVector2D &Location) const
+{
+    return FIntPoint(
+        FMath::FloorToInt32(Location.X / CellSize),
+        FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void FCattleAreaSpatialGrid::Insert(int32 ItemId, const FBox2D &Bounds)
+{
+    if (!Bounds.bIsValid)
+    {
+        return;
+    }
+
+    if (Items.Contains(ItemId))
+    {
+        Remove(ItemId);
+    }
+
+    FItemRecord Record;
+    InitRecord(Record, Bounds);
+
+    FCellEntry Entry;
+    Entry.ItemId = ItemId;
+    Entry.Bounds = Bounds;
+
+    if (Record.bOversized)
+    {
+        OversizedItems.Add(Entry);
+    }
+    else
+    {
+        ForEachCoveredCell(Record, [this, &Entry](const FIntPoint &Cell)
+                           { Cells.FindOrAdd(Cell).Add(Entry); });
+    }
+
+    Items.Add(ItemId, Record);
+}
+
+void FCattleAreaSpatialGrid::Remove(int32 ItemId)
+{
+    FItemRecord Record;
+    if (!Items.RemoveAndCopyValue(ItemId, Record))
+    {
+        return;
+    }
+
+    if (Record.bOversized)
+    {
+        OversizedItems.RemoveAllSwap([ItemId](const FCellEntry &Entry)
+                                     { return Entry.ItemId == ItemId; });
+        return;
+    }
+
+    ForEachCoveredCell(Record, [this, ItemId](const FIntPoint &Cell)
+                       { RemoveFromCell(Cell, ItemId); });
+}
+
+void FCattleAreaSpatialGrid::InitRecord(FItemRecord &Record, const FBox2D &Bounds) const
+{
+    Record.Bounds = Bounds;
+    Record.MinCell = GetCellAtLocation(Bounds.Min);
+    Record.MaxCell = GetCellAtLocation(Bounds.Max);
+
+    const int64 NumCells = static_cast<int64>(Record.MaxCell.X - Record.MinCell.X + 1) * static_cast<int64>(Record.MaxCell.Y - Record.MinCell.Y + 1);
+    Record.bOversized = NumCells > MaxCellsPerItem;
+}
+
+void FCattleAreaSpatialGrid::RemoveFromCell(const FIntPoint &Cell, int32 ItemId)
+{
+    if (TArray<FCellEntry> *Entries = Cells.Find(Cell))
+    {
+        Entries->RemoveAllSwap([ItemId](const FCellEntry &Entry)
+                               { return Entry.ItemId == ItemId; });
+        if (Entries->Num() == 0)
+        {
+            Cells.Remove(Cell);
+        }
+    }
+}
+
+void FCattleAreaSpatialGrid::Update(int32 ItemId, const FBox2D &Bounds)
+{
+    FItemRecord *Record = Items.Find(ItemId);
+    if (!Record || !Bounds.bIsValid)
+    {
+        Remove(ItemId);
+        Insert(ItemId, Bounds);
+        return;
+    }
+
+    FItemRecord NewRecord;
+    InitRecord(NewRecord, Bounds);
+
+    // Moving between cell storage and the oversized list needs a full re-insert
+    if (NewRecord.bOversized != Record->bOversized)
+    {
+        Remove(ItemId);
+        Insert(ItemId, Bounds);
+        return;
+    }
+
+    auto UpdateEntryBounds = [ItemId, &Bounds](TArray<FCellEntry> &Entries)
+    {
+        for (FCellEntry &Entry : Entries)
+        {
+            if (Entry.ItemId == ItemId)
+            {
+                Entry.Bounds = Bounds;
+                return;
+            }
+        }
+    };
+
+    if (NewRecord.bOversized)
+    {
+        UpdateEntryBounds(OversizedItems);
+    }
+    else
+    {
+        const FItemRecord &OldRecord = *Record;
+
+        // Small moves usually stay within the same cells, so most updates only rewrite bounds in place
+        ForEachCoveredCell(OldRecord, [this, &NewRecord, ItemId](const FIntPoint &Cell)
+                           {
+            if (!CoversCell(NewRecord, Cell))
+            {
+                RemoveFromCell(Cell, ItemId);
+            } });
+
+        FCellEntry Entry;
+        Entry.ItemId = ItemId;
+        Entry.Bounds = Bounds;
+
+        ForEachCoveredCell(NewRecord, [this, &OldRecord, &Entry, &UpdateEntryBounds](const FIntPoint &Cell)
+                           {
+            if (CoversCell(OldRecord, Cell))
+            {
+                UpdateEntryBounds(Cells.FindChecked(Cell));
+            }
+            else
+            {
+                Cells.FindOrAdd(Cell).Add(Entry);
+            } });
+    }
+
+    *Record = NewRecord;
+}
+
+bool FCattleAreaSpatialGrid::GetItemBounds(int32 ItemId, FBox2D &OutBounds) const
+{
+    if (const FItemRecord *Record = Items.Find(ItemId))
+    {
+        OutBounds = Record->Bounds;
+        return true;
+    }
+    return false;
+}
+
+void FCattleAreaSpatialGrid::GetItemsInBounds(const FBox2D &Bounds, TArray<int32> &OutItemIds) const
+{
+    OutItemIds.Reset();
+
+    if (!Bounds.bIsValid)
+    {
+        return;
+    }
+
+    FItemRecord Query;
+    Query.MinCell = GetCellAtLocation(Bounds.Min);
+    Query.MaxCell = GetCellAtLocation(Bounds.Max);
+
+    const int64 NumCells = static_cast<int64>(Query.MaxCell.X - Query.MinCell.X + 1) * static_cast<int64>(Query.MaxCell.Y - Query.MinCell.Y + 1);
+
+    auto AddOverlapping = [&Bounds, &OutItemIds](const TArray<FCellEntry> &Entries)
+    {
+        for (const FCellEntry &Entry : Entries)
+        {
+            if (Entry.Bounds.Intersect(Bounds))
+            {
+                OutItemIds.AddUnique(Entry.ItemId);
+            }
+        }
+    };
+
+    if (NumCells > Cells.Num())
+    {
+        // Query covers more cells than are occupied; scan the occupied ones instead
+        for (const TPair<FIntPoint, TArray<FCellEntry>> &Pair : Cells)
+        {
+            AddOverlapping(Pair.Value);
+        }
+    }
+    else
+    {
+        ForEachCoveredCell(Query, [this, &AddOverlapping](const FIntPoint &Cell)
+                           {
+            if (const TArray<FCellEntry> *Entries = Cells.Find(Cell))
+            {
+                AddOverlapping(*Entries);
+            } });
+    }
+
+    AddOverlapping(OversizedItems);
+}
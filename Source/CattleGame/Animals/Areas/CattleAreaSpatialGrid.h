@@ -0,0 +1,131 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FCattleAreaSpatialGrid
+ *
+ * Uniform 2D grid over world XY used to narrow area queries down to the few
+ * items whose bounds overlap the queried point. Items are identified by an
+ * integer id chosen by the owner (the subsystem uses its area slot index).
+ *
+ * Items covering more than MaxCellsPerItem cells are kept in a separate list
+ * that is visited by every query instead of being written into every cell.
+ */
+class CATTLEGAME_API FCattleAreaSpatialGrid
+{
+public:
+    explicit FCattleAreaSpatialGrid(float InCellSize = 2000.0f);
+
+    /** Remove all items and optionally change the cell size */
+    void Reset(float InCellSize = 0.0f);
+
+    /** Add an item covering the given world-space XY bounds */
+    void Insert(int32 ItemId, const FBox2D &Bounds);
+
+    /** Remove an item from every cell it covers */
+    void Remove(int32 ItemId);
+
+    /** Move an item to new bounds, only touching the cells it enters or leaves */
+    void Update(int32 ItemId, const FBox2D &Bounds);
+
+    /** Whether an item with this id is in the grid */
+    bool Contains(int32 ItemId) const { return Items.Contains(ItemId); }
+
+    /** Bounds an item was inserted with; false if the item is not in the grid */
+    bool GetItemBounds(int32 ItemId, FBox2D &OutBounds) const;
+
+    /** Collect every item whose bounds overlap the given bounds, each reported once */
+    void GetItemsInBounds(const FBox2D &Bounds, TArray<int32> &OutItemIds) const;
+
+    /** Number of items in the grid */
+    int32 Num() const { return Items.Num(); }
+
+    float GetCellSize() const { return CellSize; }
+
+    /** Get the cell coordinate containing a world XY location */
+    FIntPoint GetCellAtLocation(const FVector2D &Location) const;
+
+    /**
+     * Call Func(ItemId) for every item whose bounds contain the location.
+     * Only one cell is visited, so no item is reported twice.
+     */
+    template <typename FuncType>
+    void ForEachItemAtLocation(const FVector2D &Location, FuncType &&Func) const
+    {
+        if (const TArray<FCellEntry> *Entries = Cells.Find(GetCellAtLocation(Location)))
+        {
+            for (const FCellEntry &Entry : *Entries)
+            {
+                if (Entry.Bounds.IsInsideOrOn(Location))
+                {
+                    Func(Entry.ItemId);
+                }
+            }
+        }
+
+        for (const FCellEntry &Entry : OversizedItems)
+        {
+            if (Entry.Bounds.IsInsideOrOn(Location))
+            {
+                Func(Entry.ItemId);
+            }
+        }
+    }
+
+    /** Maximum number of cells a single item is written into before it is treated as oversized */
+    static constexpr int32 MaxCellsPerItem = 4096;
+
+private:
+    struct FCellEntry
+    {
+        int32 ItemId = INDEX_NONE;
+        FBox2D Bounds = FBox2D(ForceInit);
+    };
+
+    struct FItemRecord
+    {
+        FBox2D Bounds = FBox2D(ForceInit);
+        FIntPoint MinCell = FIntPoint::ZeroValue;
+        FIntPoint MaxCell = FIntPoint::ZeroValue;
+        bool bOversized = false;
+    };
+
+    /** Whether a record covers a cell coordinate */
+    static bool CoversCell(const FItemRecord &Record, const FIntPoint &Cell)
+    {
+        return Cell.X >= Record.MinCell.X && Cell.X <= Record.MaxCell.X && Cell.Y >= Record.MinCell.Y && Cell.Y <= Record.MaxCell.Y;
+    }
+
+    /** Fill a record's cell range and oversized flag from bounds */
+    void InitRecord(FItemRecord &Record, const FBox2D &Bounds) const;
+
+    /** Remove an item's entry from one cell, dropping the cell when it empties */
+    void RemoveFromCell(const FIntPoint &Cell, int32 ItemId);
+
+    /** Visit every cell coordinate covered by a record */
+    template <typename FuncType>
+    static void ForEachCoveredCell(const FItemRecord &Record, FuncType &&Func)
+    {
+        for (int32 Y = Record.MinCell.Y; Y <= Record.MaxCell.Y; ++Y)
+        {
+            for (int32 X = Record.MinCell.X; X <= Record.MaxCell.X; ++X)
+            {
+                Func(FIntPoint(X, Y));
+            }
+        }
+    }
+
+    float CellSize;
+
+    /** Cell coordinate -> items overlapping that cell */
+    TMap<FIntPoint, TArray<FCellEntry>> Cells;
+
+    /** Items too large to be written into individual cells */
+    TArray<FCellEntry> OversizedItems;
+
+    /** Per-item bookkeeping for removal */
+    TMap<int32, FItemRecord> Items;
+};
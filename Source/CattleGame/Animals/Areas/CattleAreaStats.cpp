@@ -0,0 +1,42 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleAreaStats.h"
+
+DEFINE_STAT(STAT_CattleArea_GetAreasAtLocation);
+DEFINE_STAT(STAT_CattleArea_GetPrimaryAreaAtLocation);
+DEFINE_STAT(STAT_CattleArea_GetPrimaryAreasAtLocations);
+DEFINE_STAT(STAT_CattleArea_GetFlowDirectionAtLocation);
+DEFINE_STAT(STAT_CattleArea_IsLocationInAreaType);
+DEFINE_STAT(STAT_CattleArea_GetAreasOfType);
+DEFINE_STAT(STAT_CattleArea_VisitAreasAtLocation);
+DEFINE_STAT(STAT_CattleArea_RefreshTrackedAnimal);
+DEFINE_STAT(STAT_CattleArea_UpdateAreaBounds);
+DEFINE_STAT(STAT_CattleArea_LaunchInfluenceBake);
+DEFINE_STAT(STAT_CattleArea_FlushInfluenceBake);
+
+DEFINE_STAT(STAT_CattleArea_Queries);
+DEFINE_STAT(STAT_CattleArea_AreasTested);
+DEFINE_STAT(STAT_CattleArea_SplineEvaluations);
+
+DEFINE_STAT(STAT_CattleArea_RegisteredAreas);
+DEFINE_STAT(STAT_CattleArea_TrackedAnimals);
+
+CSV_DEFINE_CATEGORY_MODULE(CATTLEGAME_API, CattleAreas, true);
+
+void FCattleAreaFrameCounters::Flush(bool bReport)
+{
+    // Unused when the CSV profiler is compiled out
+    [[maybe_unused]] const int32 FrameQueries = Queries.exchange(0, std::memory_order_relaxed);
+    [[maybe_unused]] const int32 FrameAreasTested = AreasTested.exchange(0, std::memory_order_relaxed);
+    [[maybe_unused]] const int32 FrameSplineEvaluations = SplineEvaluations.exchange(0, std::memory_order_relaxed);
+
+    if (!bReport)
+    {
+        return;
+    }
+
+    CSV_CUSTOM_STAT(CattleAreas, Queries, FrameQueries, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(CattleAreas, AreasTested, FrameAreasTested, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(CattleAreas, AreasTestedPerQuery, FrameQueries > 0 ? static_cast<float>(FrameAreasTested) / FrameQueries : 0.0f, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(CattleAreas, SplineEvaluations, FrameSplineEvaluations, ECsvCustomStatOp::Set);
+}
@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include <atomic>
+
+DECLARE_STATS_GROUP(TEXT("Cattle Areas"), STATGROUP_CattleAreas, STATCAT_Advanced);
+
+// ===== Query Timings =====
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetAreasAtLocation"), STAT_CattleArea_GetAreasAtLocation, STATGROUP_CattleAreas, CATTLEGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetPrimaryAreaAtLocation"), STAT_CattleArea_GetPrimaryAreaAtLocation, STATGROUP_CattleAreas, CATTLEGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetPrimaryAreasAtLocations"), STAT_CattleArea_GetPrimaryAreasAtLocations, STATGROUP_CattleAreas, CATTLEGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetFlowDirectionAtLocation"), STAT_CattleArea_GetFlowDirectionAtLocation, STATGROUP_CattleAreas, CATTLEGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("IsLocationInAreaType"), STAT_CattleArea_IsLocationInAreaType, STATGROUP_CattleAreas, CATTLEGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetAreasOfType"), STAT_CattleArea_GetAreasOfType, STATGROUP_CattleAreas, CATTLEGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("VisitAreasAtLocation"), STAT_CattleArea_VisitAreasAtLocation, STATGROUP_CattleAreas, CATTLEGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RefreshTrackedAnimal"), STAT_CattleArea_RefreshTrackedAnimal, STATGROUP_CattleAreas, CATTLEGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateAreaBounds"), STAT_CattleArea_UpdateAreaBounds, STATGROUP_CattleAreas, CATTLEGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LaunchInfluenceBake"), STAT_CattleArea_LaunchInfluenceBake, STATGROUP_CattleAreas, CATTLEGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("FlushInfluenceBake"), STAT_CattleArea_FlushInfluenceBake, STATGROUP_CattleAreas, CATTLEGAME_API);
+
+// ===== Per-Frame Counters =====
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Queries"), STAT_CattleArea_Queries, STATGROUP_CattleAreas, CATTLEGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Areas Tested"), STAT_CattleArea_AreasTested, STATGROUP_CattleAreas, CATTLEGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spline Evaluations"), STAT_CattleArea_SplineEvaluations, STATGROUP_CattleAreas, CATTLEGAME_API);
+
+// ===== Totals =====
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Registered Areas"), STAT_CattleArea_RegisteredAreas, STATGROUP_CattleAreas, CATTLEGAME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Tracked Animals"), STAT_CattleArea_TrackedAnimals, STATGROUP_CattleAreas, CATTLEGAME_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(CATTLEGAME_API, CattleAreas);
+
+/** Cycle stat plus CSV timing for a scope; Name must match a STAT_CattleArea_<Name> declared above */
+#define CATTLE_AREA_SCOPE(Name)                   \
+    SCOPE_CYCLE_COUNTER(STAT_CattleArea_##Name); \
+    CSV_SCOPED_TIMING_STAT(CattleAreas, Name)
+
+/**
+ * FCattleAreaFrameCounters
+ *
+ * Counters that feed both the stat system and the CSV profiler. Stat counters
+ * reset themselves every frame; the CSV totals belong to one area subsystem,
+ * so each world counts only its own queries, and are reset by Flush, which
+ * the subsystem calls once per frame and which reports them for a single
+ * world per process. Safe to count from the background bake.
+ */
+struct FCattleAreaFrameCounters
+{
+    FORCEINLINE void CountQueries(int32 Count = 1)
+    {
+        INC_DWORD_STAT_BY(STAT_CattleArea_Queries, Count);
+        Queries.fetch_add(Count, std::memory_order_relaxed);
+    }
+
+    FORCEINLINE void CountAreasTested(int32 Count = 1)
+    {
+        INC_DWORD_STAT_BY(STAT_CattleArea_AreasTested, Count);
+        AreasTested.fetch_add(Count, std::memory_order_relaxed);
+    }
+
+    FORCEINLINE void CountSplineEvaluation()
+    {
+        INC_DWORD_STAT(STAT_CattleArea_SplineEvaluations);
+        SplineEvaluations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /** Report this frame's totals (and areas tested per query) to the CSV profiler if bReport, and reset them */
+    CATTLEGAME_API void Flush(bool bReport);
+
+private:
+    std::atomic<int32> Queries{0};
+    std::atomic<int32> AreasTested{0};
+    std::atomic<int32> SplineEvaluations{0};
+};
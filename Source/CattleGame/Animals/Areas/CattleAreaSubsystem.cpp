@@ -2,21 +2,48 @@
 
 #include "CattleAreaSubsystem.h"
 #include "CattleAreaBase.h"
+#include "CattleAreaStats.h"
 #include "CattleFlowGuide.h"
+#include "CattleGame/Animals/CattleAnimal.h"
+#include "Components/BoxComponent.h"
 #include "DrawDebugHelpers.h"
 
 void UCattleAreaSubsystem::Initialize(FSubsystemCollectionBase &Collection)
 {
     Super::Initialize(Collection);
 
-    RegisteredAreas.Empty();
+    AreaSlots.Empty();
     RegisteredFlowGuides.Empty();
+    AreaGrid.Reset(AreaGridCellSize);
+    DynamicAreaGrid.Reset(AreaGridCellSize);
+    InfluenceGrid.Reset(BakedCellSize);
 }
 
 void UCattleAreaSubsystem::Deinitialize()
 {
-    RegisteredAreas.Empty();
+    FlushInfluenceBake();
+
+    DEC_DWORD_STAT_BY(STAT_CattleArea_RegisteredAreas, AreaSlots.Num());
+    DEC_DWORD_STAT_BY(STAT_CattleArea_TrackedAnimals, TrackedAnimals.Num());
+
+    // Areas can outlive the subsystem during world teardown
+    for (const FRegisteredArea &Slot : AreaSlots)
+    {
+        if (ACattleAreaBase *Area = Slot.Area.Get())
+        {
+            Area->FrameCounters = nullptr;
+        }
+    }
+
+    AreaSlots.Empty();
     RegisteredFlowGuides.Empty();
+    AreaGrid.Reset();
+    DynamicAreaGrid.Reset();
+    InfluenceGrid.Reset();
+    TrackedAnimals.Empty();
+    RecentAreaChanges.Empty();
+    ActiveTransientAreas.Empty();
+    FreeTransientAreas.Empty();
 
     Super::Deinitialize();
 }
@@ -31,17 +58,247 @@ bool UCattleAreaSubsystem::ShouldCreateSubsystem(UObject *Outer) const
     return false;
 }
 
+void UCattleAreaSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // One process has one CSV; editor worlds and extra PIE clients only reset so the server or standalone world's counts are the ones reported
+    const UWorld *World = GetWorld();
+    FrameCounters.Flush(World->IsGameWorld() && (!GIsEditor || World->GetNetMode() != NM_Client));
+
+    ReleaseExpiredTransientAreas();
+
+    if (!bUseBakedInfluenceGrid)
+    {
+        return;
+    }
+
+    if (PendingBake.IsValid() && PendingBakeTask.IsCompleted())
+    {
+        FlushInfluenceBake();
+    }
+
+    if (!PendingBake.IsValid() && InfluenceGrid.HasDirtyTiles())
+    {
+        LaunchInfluenceBake();
+    }
+}
+
+TStatId UCattleAreaSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCattleAreaSubsystem, STATGROUP_Tickables);
+}
+
 void UCattleAreaSubsystem::RegisterArea(ACattleAreaBase *Area)
 {
-    if (Area && !RegisteredAreas.Contains(Area))
+    if (!Area || FindAreaSlot(Area) != INDEX_NONE)
+    {
+        return;
+    }
+
+    FRegisteredArea Slot;
+    Slot.Area = Area;
+    Slot.Serial = NextAreaSerial++;
+    Slot.bDynamic = Area->bDynamicArea;
+
+    INC_DWORD_STAT(STAT_CattleArea_RegisteredAreas);
+
+    if (Slot.bDynamic)
     {
-        RegisteredAreas.Add(Area);
+        // Dynamic areas are never baked, so there is nothing to rebake
+        const int32 Index = AreaSlots.Add(Slot);
+        DynamicAreaGrid.Insert(Index, Area->GetAreaBounds2D());
+        Area->AreaHandle = {Index, Slot.Serial};
+        Area->FrameCounters = &FrameCounters;
+        return;
     }
+
+    const int32 Index = AreaSlots.Add(Slot);
+    AreaGrid.Insert(Index, Area->GetAreaBounds2D());
+    Area->AreaHandle = {Index, Slot.Serial};
+    Area->FrameCounters = &FrameCounters;
+    MarkAreaDirty(Index);
 }
 
 void UCattleAreaSubsystem::UnregisterArea(ACattleAreaBase *Area)
 {
-    RegisteredAreas.Remove(Area);
+    const int32 Index = FindAreaSlot(Area);
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+
+    if (AreaSlots[Index].bDynamic)
+    {
+        DynamicAreaGrid.Remove(Index);
+    }
+    else
+    {
+        // Slot indices are stable, so only the removed area's own footprint changes
+        MarkAreaDirty(Index);
+        AreaGrid.Remove(Index);
+    }
+
+    AreaSlots.RemoveAt(Index);
+    Area->AreaHandle = FCattleAreaHandle();
+    Area->FrameCounters = nullptr;
+
+    DEC_DWORD_STAT(STAT_CattleArea_RegisteredAreas);
+}
+
+void UCattleAreaSubsystem::UpdateAreaBounds(ACattleAreaBase *Area)
+{
+    CATTLE_AREA_SCOPE(UpdateAreaBounds);
+
+    const int32 Index = FindAreaSlot(Area);
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+
+    if (AreaSlots[Index].bDynamic)
+    {
+        DynamicAreaGrid.Update(Index, Area->GetAreaBounds2D());
+        return;
+    }
+
+    // Old and new footprints; no need to wait for a running bake, its results for these tiles are discarded
+    MarkAreaDirty(Index);
+    AreaGrid.Update(Index, Area->GetAreaBounds2D());
+    MarkAreaDirty(Index);
+}
+
+int32 UCattleAreaSubsystem::FindAreaSlot(const ACattleAreaBase *Area) const
+{
+    if (!Area)
+    {
+        return INDEX_NONE;
+    }
+
+    const FCattleAreaHandle &Handle = Area->GetAreaHandle();
+    if (!AreaSlots.IsValidIndex(Handle.Index))
+    {
+        return INDEX_NONE;
+    }
+
+    // A handle from an earlier registration (or another world) can point at a reused slot
+    const FRegisteredArea &Slot = AreaSlots[Handle.Index];
+    return (Slot.Serial == Handle.Serial && Slot.Area.Get() == Area) ? Handle.Index : INDEX_NONE;
+}
+
+bool UCattleAreaSubsystem::IsNearDynamicArea(const FVector &Location) const
+{
+    bool bFound = false;
+    DynamicAreaGrid.ForEachItemAtLocation(FVector2D(Location), [&bFound](int32 Index)
+                                          { bFound = true; });
+    return bFound;
+}
+
+ACattleAreaBase *UCattleAreaSubsystem::AcquireTransientArea(TSubclassOf<ACattleAreaBase> AreaClass, const FTransform &Transform, float Lifetime)
+{
+    UWorld *World = GetWorld();
+    if (!World || !AreaClass)
+    {
+        return nullptr;
+    }
+
+    ACattleAreaBase *Area = nullptr;
+
+    // Most recently released first; pools rarely hold more than a couple of classes
+    for (int32 i = FreeTransientAreas.Num() - 1; i >= 0; --i)
+    {
+        ACattleAreaBase *Candidate = FreeTransientAreas[i];
+        if (!IsValid(Candidate))
+        {
+            FreeTransientAreas.RemoveAtSwap(i, EAllowShrinking::No);
+            continue;
+        }
+
+        if (Candidate->GetClass() == AreaClass)
+        {
+            FreeTransientAreas.RemoveAtSwap(i, EAllowShrinking::No);
+            Area = Candidate;
+            break;
+        }
+    }
+
+    if (Area)
+    {
+        Area->SetActorTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+        Area->SetActorHiddenInGame(false);
+        RegisterArea(Area);
+    }
+    else
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        SpawnParams.bDeferConstruction = true;
+
+        Area = World->SpawnActor<ACattleAreaBase>(AreaClass, Transform, SpawnParams);
+        if (!Area)
+        {
+            return nullptr;
+        }
+
+        Area->bDynamicArea = true;
+        Area->FinishSpawning(Transform);
+
+        // BeginPlay registers the area; this covers worlds that have not begun play yet
+        RegisterArea(Area);
+    }
+
+    FActiveTransientArea &Active = ActiveTransientAreas.AddDefaulted_GetRef();
+    Active.Area = Area;
+    Active.ExpireTime = Lifetime > 0.0f ? World->GetTimeSeconds() + Lifetime : 0.0;
+
+    return Area;
+}
+
+void UCattleAreaSubsystem::ReleaseTransientArea(ACattleAreaBase *Area)
+{
+    if (!Area)
+    {
+        return;
+    }
+
+    const int32 ActiveIndex = ActiveTransientAreas.IndexOfByPredicate([Area](const FActiveTransientArea &Active)
+                                                                      { return Active.Area.Get() == Area; });
+    if (ActiveIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    ActiveTransientAreas.RemoveAtSwap(ActiveIndex, EAllowShrinking::No);
+
+    UnregisterArea(Area);
+    Area->SetActorHiddenInGame(true);
+    FreeTransientAreas.Add(Area);
+}
+
+void UCattleAreaSubsystem::ReleaseExpiredTransientAreas()
+{
+    if (ActiveTransientAreas.Num() == 0)
+    {
+        return;
+    }
+
+    const double Now = GetWorld()->GetTimeSeconds();
+
+    for (int32 i = ActiveTransientAreas.Num() - 1; i >= 0; --i)
+    {
+        const FActiveTransientArea &Active = ActiveTransientAreas[i];
+        ACattleAreaBase *Area = Active.Area.Get();
+
+        if (!Area)
+        {
+            // Destroyed by gameplay; EndPlay already unregistered it
+            ActiveTransientAreas.RemoveAtSwap(i, EAllowShrinking::No);
+        }
+        else if (Active.ExpireTime > 0.0 && Now >= Active.ExpireTime)
+        {
+            ReleaseTransientArea(Area);
+        }
+    }
 }
 
 void UCattleAreaSubsystem::RegisterFlowGuide(ACattleFlowGuide *FlowGuide)
@@ -49,29 +306,32 @@ void UCattleAreaSubsystem::RegisterFlowGuide(ACattleFlowGuide *FlowGuide)
     if (FlowGuide && !RegisteredFlowGuides.Contains(FlowGuide))
     {
         RegisteredFlowGuides.Add(FlowGuide);
+        RecordAreaChange(FBox2D(FlowGuide->GetComponentsBoundingBox(true)));
     }
 }
 
 void UCattleAreaSubsystem::UnregisterFlowGuide(ACattleFlowGuide *FlowGuide)
 {
-    RegisteredFlowGuides.Remove(FlowGuide);
+    if (RegisteredFlowGuides.Remove(FlowGuide) > 0)
+    {
+        RecordAreaChange(FBox2D(FlowGuide->GetComponentsBoundingBox(true)));
+    }
 }
 
 TArray<FCattleAreaInfluence> UCattleAreaSubsystem::GetAreasAtLocation(const FVector &Location) const
 {
+    CATTLE_AREA_SCOPE(GetAreasAtLocation);
+    FrameCounters.CountQueries();
+
     TArray<FCattleAreaInfluence> Results;
 
-    for (const TWeakObjectPtr<ACattleAreaBase> &WeakArea : RegisteredAreas)
-    {
-        if (ACattleAreaBase *Area = WeakArea.Get())
+    ForEachAreaAtLocation(Location, [&Location, &Results](int32 Index, ACattleAreaBase *Area)
+                          {
+        FCattleAreaInfluence Influence = Area->GetInfluenceAtLocation(Location);
+        if (Influence.IsValid())
         {
-            FCattleAreaInfluence Influence = Area->GetInfluenceAtLocation(Location);
-            if (Influence.IsValid())
-            {
-                Results.Add(Influence);
-            }
-        }
-    }
+            Results.Add(Influence);
+        } });
 
     // Sort by priority (highest first)
     Results.Sort([](const FCattleAreaInfluence &A, const FCattleAreaInfluence &B)
@@ -80,29 +340,383 @@ TArray<FCattleAreaInfluence> UCattleAreaSubsystem::GetAreasAtLocation(const FVec
     return Results;
 }
 
+ACattleAreaBase *UCattleAreaSubsystem::ResolveAreaHandle(const FCattleAreaHandle &Handle) const
+{
+    if (AreaSlots.IsValidIndex(Handle.Index) && AreaSlots[Handle.Index].Serial == Handle.Serial)
+    {
+        return AreaSlots[Handle.Index].Area.Get();
+    }
+    return nullptr;
+}
+
+void UCattleAreaSubsystem::VisitAreasAtLocation(const FVector &Location, TFunctionRef<void(const FCattleAreaHit &)> Visitor) const
+{
+    CATTLE_AREA_SCOPE(VisitAreasAtLocation);
+    FrameCounters.CountQueries();
+
+    ForEachAreaAtLocation(Location, [this, &Location, &Visitor](int32 Index, ACattleAreaBase *Area)
+                          {
+        const FCattleAreaInfluence Influence = Area->GetInfluenceAtLocation(Location);
+        if (Influence.AreaType == ECattleAreaType::None)
+        {
+            return;
+        }
+
+        FCattleAreaHit Hit;
+        Hit.Handle = {Index, AreaSlots[Index].Serial};
+        Hit.AreaType = Influence.AreaType;
+        Hit.Priority = Influence.Priority;
+        Hit.Strength = Influence.Strength;
+        Hit.SpeedModifier = Influence.SpeedModifier;
+        Hit.InfluenceDirection = Influence.InfluenceDirection;
+        Visitor(Hit); });
+}
+
+void UCattleAreaSubsystem::VisitAreasOfType(ECattleAreaType AreaType, TFunctionRef<void(ACattleAreaBase *)> Visitor) const
+{
+    CATTLE_AREA_SCOPE(GetAreasOfType);
+    FrameCounters.CountQueries();
+
+    for (const FRegisteredArea &Slot : AreaSlots)
+    {
+        ACattleAreaBase *Area = Slot.Area.Get();
+        if (Area && Area->GetAreaType() == AreaType)
+        {
+            Visitor(Area);
+        }
+    }
+}
+
 FCattleAreaInfluence UCattleAreaSubsystem::GetPrimaryAreaAtLocation(const FVector &Location) const
+{
+    CATTLE_AREA_SCOPE(GetPrimaryAreaAtLocation);
+    FrameCounters.CountQueries();
+
+    FCattleAreaInfluence BakedInfluence;
+    if (!bUseBakedInfluenceGrid || !InfluenceGrid.TryGetInfluence(Location, BakedInfluence))
+    {
+        return GetPrimaryAreaAtLocationLive(Location);
+    }
+
+    if (DynamicAreaGrid.Num() == 0)
+    {
+        return BakedInfluence;
+    }
+
+    // Dynamic areas are not baked, so they compete with the baked result here
+    FCattleAreaInfluence HighestPriorityInfluence = BakedInfluence;
+    int32 HighestPriority = BakedInfluence.IsValid() ? BakedInfluence.Priority : -1;
+    int32 HighestPriorityIndex = BakedInfluence.IsValid() ? BakedInfluence.AreaActor->GetAreaHandle().Index : INDEX_NONE;
+
+    DynamicAreaGrid.ForEachItemAtLocation(FVector2D(Location), [&](int32 Index)
+                                          {
+        ACattleAreaBase *Area = AreaSlots[Index].Area.Get();
+        if (!Area)
+        {
+            return;
+        }
+
+        FrameCounters.CountAreasTested();
+        FCattleAreaInfluence Influence = Area->GetInfluenceAtLocation(Location);
+        if (Influence.IsValid() && (Influence.Priority > HighestPriority || (Influence.Priority == HighestPriority && Index < HighestPriorityIndex)))
+        {
+            HighestPriority = Influence.Priority;
+            HighestPriorityIndex = Index;
+            HighestPriorityInfluence = Influence;
+        } });
+
+    return HighestPriorityInfluence;
+}
+
+FCattleAreaInfluence UCattleAreaSubsystem::GetPrimaryAreaAtLocationLive(const FVector &Location) const
 {
     FCattleAreaInfluence HighestPriorityInfluence;
     int32 HighestPriority = -1;
+    int32 HighestPriorityIndex = INDEX_NONE;
+
+    ForEachAreaAtLocation(Location, [&](int32 Index, ACattleAreaBase *Area)
+                          {
+        FCattleAreaInfluence Influence = Area->GetInfluenceAtLocation(Location);
+
+        // Ties go to the lowest slot, independent of which grid reported the area
+        if (Influence.IsValid() && (Influence.Priority > HighestPriority || (Influence.Priority == HighestPriority && Index < HighestPriorityIndex)))
+        {
+            HighestPriority = Influence.Priority;
+            HighestPriorityIndex = Index;
+            HighestPriorityInfluence = Influence;
+        } });
+
+    return HighestPriorityInfluence;
+}
+
+namespace CattleAreaBatch
+{
+    /** Per-area data prepared once per batch query, relative to the batch origin */
+    struct FAreaCandidate
+    {
+        ACattleAreaBase *Area = nullptr;
+        int32 Index = INDEX_NONE;
+        int32 Priority = 0;
+
+        /** XY bounds and height range */
+        FVector3f BoundsMin = FVector3f::ZeroVector;
+        FVector3f BoundsMax = FVector3f::ZeroVector;
+
+        /** Box shape: local = BoxOrigin + X * BoxAxisX + Y * BoxAxisY + Z * BoxAxisZ */
+        bool bExactBox = false;
+        FVector3f BoxOrigin = FVector3f::ZeroVector;
+        FVector3f BoxAxisX = FVector3f::ZeroVector;
+        FVector3f BoxAxisY = FVector3f::ZeroVector;
+        FVector3f BoxAxisZ = FVector3f::ZeroVector;
+        FVector3f BoxExtent = FVector3f::ZeroVector;
+
+        /** Polygon shape: first edge in PolygonEdges and number of edges */
+        bool bExactPolygon = false;
+        int32 FirstEdge = 0;
+        int32 NumEdges = 0;
+    };
+
+    /** Polygon edge prepared for the crossing test */
+    struct FPolygonEdge
+    {
+        float StartX;
+        float StartY;
+        float EndY;
+        float InvSlope;
+    };
+
+    /** Bitmask of lanes inside an oriented box */
+    FORCEINLINE int32 TestBox(const FAreaCandidate &Candidate, const VectorRegister4Float &X, const VectorRegister4Float &Y, const VectorRegister4Float &Z)
+    {
+        const VectorRegister4Float LocalX = VectorMultiplyAdd(Z, VectorSetFloat1(Candidate.BoxAxisZ.X), VectorMultiplyAdd(Y, VectorSetFloat1(Candidate.BoxAxisY.X), VectorMultiplyAdd(X, VectorSetFloat1(Candidate.BoxAxisX.X), VectorSetFloat1(Candidate.BoxOrigin.X))));
+        const VectorRegister4Float LocalY = VectorMultiplyAdd(Z, VectorSetFloat1(Candidate.BoxAxisZ.Y), VectorMultiplyAdd(Y, VectorSetFloat1(Candidate.BoxAxisY.Y), VectorMultiplyAdd(X, VectorSetFloat1(Candidate.BoxAxisX.Y), VectorSetFloat1(Candidate.BoxOrigin.Y))));
+        const VectorRegister4Float LocalZ = VectorMultiplyAdd(Z, VectorSetFloat1(Candidate.BoxAxisZ.Z), VectorMultiplyAdd(Y, VectorSetFloat1(Candidate.BoxAxisY.Z), VectorMultiplyAdd(X, VectorSetFloat1(Candidate.BoxAxisX.Z), VectorSetFloat1(Candidate.BoxOrigin.Z))));
+
+        VectorRegister4Float Inside = VectorCompareLE(VectorAbs(LocalX), VectorSetFloat1(Candidate.BoxExtent.X));
+        Inside = VectorBitwiseAnd(Inside, VectorCompareLE(VectorAbs(LocalY), VectorSetFloat1(Candidate.BoxExtent.Y)));
+        Inside = VectorBitwiseAnd(Inside, VectorCompareLE(VectorAbs(LocalZ), VectorSetFloat1(Candidate.BoxExtent.Z)));
+        return VectorMaskBits(Inside);
+    }
+
+    /** Bitmask of lanes inside a polygon (even-odd crossing test along +X) */
+    FORCEINLINE int32 TestPolygon(const FAreaCandidate &Candidate, const TArray<FPolygonEdge> &Edges, const VectorRegister4Float &X, const VectorRegister4Float &Y)
+    {
+        VectorRegister4Float Inside = VectorZeroFloat();
+
+        for (int32 EdgeIndex = Candidate.FirstEdge; EdgeIndex < Candidate.FirstEdge + Candidate.NumEdges; ++EdgeIndex)
+        {
+            const FPolygonEdge &Edge = Edges[EdgeIndex];
+            const VectorRegister4Float StartY = VectorSetFloat1(Edge.StartY);
+
+            // Edge straddles the ray when exactly one endpoint is at or below it
+            const VectorRegister4Float Straddles = VectorBitwiseXor(VectorCompareGE(Y, StartY), VectorCompareGE(Y, VectorSetFloat1(Edge.EndY)));
+            const VectorRegister4Float IntersectX = VectorMultiplyAdd(VectorSubtract(Y, StartY), VectorSetFloat1(Edge.InvSlope), VectorSetFloat1(Edge.StartX));
+
+            Inside = VectorBitwiseXor(Inside, VectorBitwiseAnd(Straddles, VectorCompareGT(IntersectX, X)));
+        }
+
+        return VectorMaskBits(Inside);
+    }
+}
+
+void UCattleAreaSubsystem::GetPrimaryAreasAtLocations(TConstArrayView<FVector> Locations, TArray<FCattleAreaInfluence> &OutInfluences) const
+{
+    using namespace CattleAreaBatch;
 
-    for (const TWeakObjectPtr<ACattleAreaBase> &WeakArea : RegisteredAreas)
+    CATTLE_AREA_SCOPE(GetPrimaryAreasAtLocations);
+    FrameCounters.CountQueries(Locations.Num());
+
+    const int32 NumLocations = Locations.Num();
+    OutInfluences.Reset(NumLocations);
+    OutInfluences.SetNum(NumLocations);
+
+    if (NumLocations == 0)
+    {
+        return;
+    }
+
+    // Work relative to the batch center so float lanes keep their precision in large worlds
+    FBox2D BatchBounds(ForceInit);
+    for (const FVector &Location : Locations)
+    {
+        BatchBounds += FVector2D(Location);
+    }
+    const FVector Origin(BatchBounds.GetCenter(), Locations[0].Z);
+
+    // Structure-of-arrays copy, padded to whole groups of four
+    const int32 NumGroups = FMath::DivideAndRoundUp(NumLocations, 4);
+    const int32 NumPadded = NumGroups * 4;
+
+    TArray<float> LocX, LocY, LocZ;
+    LocX.SetNumUninitialized(NumPadded);
+    LocY.SetNumUninitialized(NumPadded);
+    LocZ.SetNumUninitialized(NumPadded);
+
+    for (int32 i = 0; i < NumPadded; ++i)
+    {
+        const FVector Relative = Locations[FMath::Min(i, NumLocations - 1)] - Origin;
+        LocX[i] = static_cast<float>(Relative.X);
+        LocY[i] = static_cast<float>(Relative.Y);
+        LocZ[i] = static_cast<float>(Relative.Z);
+    }
+
+    // Lanes still waiting for an area; padding lanes start resolved
+    TArray<uint8> PendingLanes;
+    PendingLanes.Init(0xF, NumGroups);
+    if (const int32 Remainder = NumLocations % 4)
     {
-        if (ACattleAreaBase *Area = WeakArea.Get())
+        PendingLanes.Last() = static_cast<uint8>((1 << Remainder) - 1);
+    }
+
+    // Gather areas that can affect the batch from both grids instead of walking every slot
+    TArray<int32> CandidateIds;
+    TArray<int32> DynamicCandidateIds;
+    AreaGrid.GetItemsInBounds(BatchBounds, CandidateIds);
+    DynamicAreaGrid.GetItemsInBounds(BatchBounds, DynamicCandidateIds);
+    CandidateIds.Append(DynamicCandidateIds);
+
+    TArray<FAreaCandidate> Candidates;
+    TArray<FPolygonEdge> PolygonEdges;
+
+    for (const int32 Index : CandidateIds)
+    {
+        ACattleAreaBase *Area = AreaSlots[Index].Area.Get();
+
+        // GetPrimaryAreaAtLocation never reports negative priorities
+        if (!Area || Area->GetEffectivePriority() < 0)
+        {
+            continue;
+        }
+
+        const FBox2D AreaBounds = Area->GetAreaBounds2D();
+        if (!AreaBounds.bIsValid || !AreaBounds.Intersect(BatchBounds))
+        {
+            continue;
+        }
+
+        float MinZ, MaxZ;
+        Area->GetHeightRange(MinZ, MaxZ);
+
+        FAreaCandidate &Candidate = Candidates.AddDefaulted_GetRef();
+        Candidate.Area = Area;
+        Candidate.Index = Index;
+        Candidate.Priority = Area->GetEffectivePriority();
+        Candidate.BoundsMin = FVector3f(FVector(AreaBounds.Min, MinZ) - Origin);
+        Candidate.BoundsMax = FVector3f(FVector(AreaBounds.Max, MaxZ) - Origin);
+
+        // Areas whose influence reaches past their shape only get the bounds test
+        if (Area->InfluenceExtendsBeyondShape())
         {
-            FCattleAreaInfluence Influence = Area->GetInfluenceAtLocation(Location);
-            if (Influence.IsValid() && Influence.Priority > HighestPriority)
+            continue;
+        }
+
+        if (const FCattleAreaPolygon *Polygon = Area->GetShapePolygon())
+        {
+            const TArray<FVector2D> &Vertices = Polygon->GetVertices();
+
+            Candidate.bExactPolygon = true;
+            Candidate.FirstEdge = PolygonEdges.Num();
+            Candidate.NumEdges = Polygon->IsValid() ? Vertices.Num() : 0;
+
+            for (int32 i = 0, j = Vertices.Num() - 1; i < Candidate.NumEdges; j = i++)
             {
-                HighestPriority = Influence.Priority;
-                HighestPriorityInfluence = Influence;
+                const FVector2D Start = Vertices[j] - FVector2D(Origin);
+                const FVector2D End = Vertices[i] - FVector2D(Origin);
+                const double DeltaY = End.Y - Start.Y;
+
+                // Horizontal edges never straddle the ray, so their slope is never used
+                PolygonEdges.Add({static_cast<float>(Start.X), static_cast<float>(Start.Y), static_cast<float>(End.Y),
+                                  FMath::IsNearlyZero(DeltaY) ? 0.0f : static_cast<float>((End.X - Start.X) / DeltaY)});
             }
         }
+        else if (const UBoxComponent *Box = Area->GetShapeBox())
+        {
+            const FTransform &BoxTransform = Box->GetComponentTransform();
+
+            Candidate.bExactBox = true;
+            Candidate.BoxOrigin = FVector3f(BoxTransform.InverseTransformPosition(Origin));
+            Candidate.BoxAxisX = FVector3f(BoxTransform.InverseTransformVector(FVector::XAxisVector));
+            Candidate.BoxAxisY = FVector3f(BoxTransform.InverseTransformVector(FVector::YAxisVector));
+            Candidate.BoxAxisZ = FVector3f(BoxTransform.InverseTransformVector(FVector::ZAxisVector));
+            Candidate.BoxExtent = FVector3f(Box->GetUnscaledBoxExtent());
+        }
     }
 
-    return HighestPriorityInfluence;
+    // Highest priority first, ties to the lowest slot, so the first hit per lane is the primary area
+    Candidates.Sort([](const FAreaCandidate &A, const FAreaCandidate &B)
+                    { return A.Priority != B.Priority ? A.Priority > B.Priority : A.Index < B.Index; });
+
+    int32 NumPending = NumLocations;
+
+    for (const FAreaCandidate &Candidate : Candidates)
+    {
+        const VectorRegister4Float MinX = VectorSetFloat1(Candidate.BoundsMin.X);
+        const VectorRegister4Float MinY = VectorSetFloat1(Candidate.BoundsMin.Y);
+        const VectorRegister4Float MinZ = VectorSetFloat1(Candidate.BoundsMin.Z);
+        const VectorRegister4Float MaxX = VectorSetFloat1(Candidate.BoundsMax.X);
+        const VectorRegister4Float MaxY = VectorSetFloat1(Candidate.BoundsMax.Y);
+        const VectorRegister4Float MaxZ = VectorSetFloat1(Candidate.BoundsMax.Z);
+
+        for (int32 Group = 0; Group < NumGroups; ++Group)
+        {
+            int32 LaneMask = PendingLanes[Group];
+            if (LaneMask == 0)
+            {
+                continue;
+            }
+
+            const VectorRegister4Float X = VectorLoad(&LocX[Group * 4]);
+            const VectorRegister4Float Y = VectorLoad(&LocY[Group * 4]);
+            const VectorRegister4Float Z = VectorLoad(&LocZ[Group * 4]);
+
+            // Broadphase: bounds and height
+            VectorRegister4Float InBounds = VectorBitwiseAnd(VectorCompareGE(X, MinX), VectorCompareLE(X, MaxX));
+            InBounds = VectorBitwiseAnd(InBounds, VectorBitwiseAnd(VectorCompareGE(Y, MinY), VectorCompareLE(Y, MaxY)));
+            InBounds = VectorBitwiseAnd(InBounds, VectorBitwiseAnd(VectorCompareGE(Z, MinZ), VectorCompareLE(Z, MaxZ)));
+            LaneMask &= VectorMaskBits(InBounds);
+
+            // Narrow phase: exact shape
+            if (LaneMask != 0 && Candidate.bExactBox)
+            {
+                LaneMask &= TestBox(Candidate, X, Y, Z);
+            }
+            else if (LaneMask != 0 && Candidate.bExactPolygon)
+            {
+                LaneMask &= TestPolygon(Candidate, PolygonEdges, X, Y);
+            }
+
+            // Confirm surviving lanes with the area's own query, which also fills direction and strength
+            for (int32 Lane = 0; LaneMask != 0; ++Lane, LaneMask >>= 1)
+            {
+                if ((LaneMask & 1) == 0)
+                {
+                    continue;
+                }
+
+                const int32 LocationIndex = Group * 4 + Lane;
+                FrameCounters.CountAreasTested();
+                FCattleAreaInfluence Influence = Candidate.Area->GetInfluenceAtLocation(Locations[LocationIndex]);
+                if (Influence.IsValid())
+                {
+                    OutInfluences[LocationIndex] = MoveTemp(Influence);
+                    PendingLanes[Group] &= static_cast<uint8>(~(1 << Lane));
+                    --NumPending;
+                }
+            }
+        }
+
+        if (NumPending == 0)
+        {
+            break;
+        }
+    }
 }
 
 FVector UCattleAreaSubsystem::GetFlowDirectionAtLocation(const FVector &Location) const
 {
+    CATTLE_AREA_SCOPE(GetFlowDirectionAtLocation);
+    FrameCounters.CountQueries();
+
     FVector AccumulatedFlow = FVector::ZeroVector;
     float TotalWeight = 0.0f;
 
@@ -131,35 +745,25 @@ FVector UCattleAreaSubsystem::GetFlowDirectionAtLocation(const FVector &Location
 
 bool UCattleAreaSubsystem::IsLocationInAreaType(const FVector &Location, ECattleAreaType AreaType) const
 {
-    for (const TWeakObjectPtr<ACattleAreaBase> &WeakArea : RegisteredAreas)
-    {
-        if (ACattleAreaBase *Area = WeakArea.Get())
+    CATTLE_AREA_SCOPE(IsLocationInAreaType);
+    FrameCounters.CountQueries();
+
+    bool bFound = false;
+
+    ForEachAreaAtLocation(Location, [&Location, AreaType, &bFound](int32 Index, ACattleAreaBase *Area)
+                          {
+        if (!bFound && Area->GetAreaType() == AreaType && Area->IsLocationInArea(Location))
         {
-            if (Area->GetAreaType() == AreaType && Area->IsLocationInArea(Location))
-            {
-                return true;
-            }
-        }
-    }
+            bFound = true;
+        } });
 
-    return false;
+    return bFound;
 }
 
 TArray<ACattleAreaBase *> UCattleAreaSubsystem::GetAreasOfType(ECattleAreaType AreaType) const
 {
     TArray<ACattleAreaBase *> Results;
-
-    for (const TWeakObjectPtr<ACattleAreaBase> &WeakArea : RegisteredAreas)
-    {
-        if (ACattleAreaBase *Area = WeakArea.Get())
-        {
-            if (Area->GetAreaType() == AreaType)
-            {
-                Results.Add(Area);
-            }
-        }
-    }
-
+    GetAreasOfType(AreaType, Results);
     return Results;
 }
 
@@ -169,9 +773,9 @@ void UCattleAreaSubsystem::DrawDebugAreas(float Duration) const
     if (!World)
         return;
 
-    for (const TWeakObjectPtr<ACattleAreaBase> &WeakArea : RegisteredAreas)
+    for (const FRegisteredArea &Slot : AreaSlots)
     {
-        if (ACattleAreaBase *Area = WeakArea.Get())
+        if (ACattleAreaBase *Area = Slot.Area.Get())
         {
             Area->DrawDebugArea(Duration);
         }
@@ -188,9 +792,387 @@ void UCattleAreaSubsystem::DrawDebugAreas(float Duration) const
 
 void UCattleAreaSubsystem::CleanupInvalidReferences()
 {
-    RegisteredAreas.RemoveAll([](const TWeakObjectPtr<ACattleAreaBase> &WeakArea)
-                              { return !WeakArea.IsValid(); });
+    for (TSparseArray<FRegisteredArea>::TIterator It(AreaSlots); It; ++It)
+    {
+        if (!It->Area.IsValid())
+        {
+            It.RemoveCurrent();
+            DEC_DWORD_STAT(STAT_CattleArea_RegisteredAreas);
+        }
+    }
 
     RegisteredFlowGuides.RemoveAll([](const TWeakObjectPtr<ACattleFlowGuide> &WeakFlowGuide)
                                    { return !WeakFlowGuide.IsValid(); });
+
+    RebuildAreaGrid();
+}
+
+void UCattleAreaSubsystem::RebuildAreaGrid()
+{
+    FlushInfluenceBake();
+
+    AreaGrid.Reset(AreaGridCellSize);
+    DynamicAreaGrid.Reset(AreaGridCellSize);
+    InfluenceGrid.Reset(BakedCellSize);
+
+    // Removed areas were never marked dirty, so every tracked animal re-evaluates
+    RecordAreaChange(FBox2D(ForceInit));
+
+    for (TSparseArray<FRegisteredArea>::TConstIterator It(AreaSlots); It; ++It)
+    {
+        if (ACattleAreaBase *Area = It->Area.Get())
+        {
+            if (It->bDynamic)
+            {
+                DynamicAreaGrid.Insert(It.GetIndex(), Area->GetAreaBounds2D());
+            }
+            else
+            {
+                AreaGrid.Insert(It.GetIndex(), Area->GetAreaBounds2D());
+                MarkAreaDirty(It.GetIndex());
+            }
+        }
+    }
+}
+
+void UCattleAreaSubsystem::MarkAreaDirty(int32 AreaIndex)
+{
+    FBox2D Bounds;
+    if (!AreaGrid.GetItemBounds(AreaIndex, Bounds))
+    {
+        return;
+    }
+
+    if (bUseBakedInfluenceGrid)
+    {
+        InfluenceGrid.MarkDirty(Bounds);
+    }
+
+    RecordAreaChange(Bounds);
+}
+
+void UCattleAreaSubsystem::TrackAnimal(ACattleAnimal *Animal)
+{
+    if (Animal && !TrackedAnimals.Contains(Animal))
+    {
+        INC_DWORD_STAT(STAT_CattleArea_TrackedAnimals);
+        TrackedAnimals.Add(Animal);
+        RefreshTrackedAnimal(Animal, true);
+    }
+}
+
+void UCattleAreaSubsystem::UntrackAnimal(ACattleAnimal *Animal)
+{
+    if (TrackedAnimals.Remove(Animal) > 0)
+    {
+        DEC_DWORD_STAT(STAT_CattleArea_TrackedAnimals);
+    }
+}
+
+bool UCattleAreaSubsystem::RefreshTrackedAnimal(ACattleAnimal *Animal, bool bForce)
+{
+    CATTLE_AREA_SCOPE(RefreshTrackedAnimal);
+
+    FTrackedAnimal *Tracked = Animal ? TrackedAnimals.Find(Animal) : nullptr;
+    if (!Tracked)
+    {
+        return false;
+    }
+
+    const FVector Location = Animal->GetActorLocation();
+    const FIntVector Cell = GetTrackingCell(Location);
+
+    // Dynamic areas do not record their moves, so animals near them always search
+    if (!bForce && Tracked->LayoutVersion != 0 && !Tracked->bInDynamicArea && !IsNearDynamicArea(Location))
+    {
+        // Idle animals stop here: same cell and nothing changed around it
+        if (Cell == Tracked->Cell && !HasAreaChangedInCell(Cell, Tracked->LayoutVersion))
+        {
+            Tracked->LayoutVersion = AreaLayoutVersion;
+            return false;
+        }
+
+        // Still provably inside the same areas: only the primary area's influence needs refreshing
+        const FBox2D SafeBounds(FVector2D(Tracked->SearchLocation) - FVector2D(Tracked->SafeRadius), FVector2D(Tracked->SearchLocation) + FVector2D(Tracked->SafeRadius));
+        if (FVector::DistSquared(Location, Tracked->SearchLocation) < FMath::Square(Tracked->SafeRadius) && !HasAreaChangedInBounds(SafeBounds, Tracked->LayoutVersion))
+        {
+            FrameCounters.CountQueries();
+            FrameCounters.CountAreasTested(Tracked->PrimaryHandle.IsValid() ? 1 : 0);
+
+            ACattleAreaBase *PrimaryArea = ResolveAreaHandle(Tracked->PrimaryHandle);
+            const FCattleAreaInfluence Influence = PrimaryArea ? PrimaryArea->GetInfluenceAtLocation(Location) : FCattleAreaInfluence();
+
+            if (Influence.IsValid() == Tracked->PrimaryHandle.IsValid())
+            {
+                Tracked->Cell = Cell;
+                Tracked->LayoutVersion = AreaLayoutVersion;
+                Animal->ApplyAreaEvaluation(Influence, GetTrackedFlowDirection(*Tracked, Location));
+                return true;
+            }
+        }
+    }
+
+    Tracked->Cell = Cell;
+    Tracked->LayoutVersion = AreaLayoutVersion;
+    FrameCounters.CountQueries();
+
+    // Collect membership and the primary influence in one pass over the indexed areas
+    FCattleAreaInfluence PrimaryInfluence;
+    int32 PrimaryPriority = -1;
+    int32 PrimaryIndex = INDEX_NONE;
+    TArray<TWeakObjectPtr<ACattleAreaBase>, TInlineAllocator<4>> NewAreas;
+    bool bInDynamicArea = false;
+
+    ForEachAreaAtLocation(Location, [&](int32 Index, ACattleAreaBase *Area)
+                          {
+        FCattleAreaInfluence Influence = Area->GetInfluenceAtLocation(Location);
+        if (!Influence.IsValid())
+        {
+            return;
+        }
+
+        NewAreas.Add(Area);
+        bInDynamicArea |= AreaSlots[Index].bDynamic;
+
+        // Same selection as GetPrimaryAreaAtLocation
+        if (Influence.Priority > PrimaryPriority || (Influence.Priority == PrimaryPriority && Index < PrimaryIndex))
+        {
+            PrimaryPriority = Influence.Priority;
+            PrimaryIndex = Index;
+            PrimaryInfluence = Influence;
+        } });
+
+    TArray<ACattleAreaBase *, TInlineAllocator<4>> ExitedAreas;
+    for (const TWeakObjectPtr<ACattleAreaBase> &OldArea : Tracked->Areas)
+    {
+        if (OldArea.IsValid() && !NewAreas.Contains(OldArea))
+        {
+            ExitedAreas.Add(OldArea.Get());
+        }
+    }
+
+    TArray<ACattleAreaBase *, TInlineAllocator<4>> EnteredAreas;
+    for (const TWeakObjectPtr<ACattleAreaBase> &NewArea : NewAreas)
+    {
+        if (!Tracked->Areas.Contains(NewArea))
+        {
+            EnteredAreas.Add(NewArea.Get());
+        }
+    }
+
+    const FCattleAreaHandle PrimaryHandle = PrimaryIndex != INDEX_NONE ? FCattleAreaHandle{PrimaryIndex, AreaSlots[PrimaryIndex].Serial} : FCattleAreaHandle();
+    const bool bAreasChanged = ExitedAreas.Num() > 0 || EnteredAreas.Num() > 0 || PrimaryHandle != Tracked->PrimaryHandle;
+
+    Tracked->Areas = MoveTemp(NewAreas);
+    Tracked->bInDynamicArea = bInDynamicArea;
+    Tracked->SearchLocation = Location;
+    Tracked->SafeRadius = bInDynamicArea ? 0.0f : ComputeSafeRadius(Location);
+    Tracked->PrimaryHandle = PrimaryHandle;
+
+    Animal->ApplyAreaEvaluation(PrimaryInfluence, GetTrackedFlowDirection(*Tracked, Location));
+
+    // Searches near dynamic areas run every time; only an actual membership change disturbs a dormant animal
+    if (bAreasChanged)
+    {
+        Animal->WakeFromDormancy();
+    }
+
+    // Listeners may untrack the animal, so Tracked must not be used past this point
+    for (ACattleAreaBase *Area : ExitedAreas)
+    {
+        Animal->OnAreaExited.Broadcast(Animal, Area);
+    }
+    for (ACattleAreaBase *Area : EnteredAreas)
+    {
+        Animal->OnAreaEntered.Broadcast(Animal, Area);
+    }
+
+    return true;
+}
+
+void UCattleAreaSubsystem::RecordAreaChange(const FBox2D &Bounds)
+{
+    ++AreaLayoutVersion;
+
+    FAreaChange &Change = RecentAreaChanges.AddDefaulted_GetRef();
+    Change.Version = AreaLayoutVersion;
+    Change.Bounds = Bounds;
+
+    if (RecentAreaChanges.Num() > MaxRecordedAreaChanges)
+    {
+        RecentAreaChanges.RemoveAt(0, RecentAreaChanges.Num() - MaxRecordedAreaChanges);
+    }
+}
+
+FIntVector UCattleAreaSubsystem::GetTrackingCell(const FVector &Location) const
+{
+    const float CellSize = FMath::Max(AnimalTrackingCellSize, 1.0f);
+    return FIntVector(
+        FMath::FloorToInt32(Location.X / CellSize),
+        FMath::FloorToInt32(Location.Y / CellSize),
+        FMath::FloorToInt32(Location.Z / CellSize));
+}
+
+bool UCattleAreaSubsystem::HasAreaChangedInCell(const FIntVector &Cell, uint32 SeenVersion) const
+{
+    const float CellSize = FMath::Max(AnimalTrackingCellSize, 1.0f);
+    const FVector2D CellMin(Cell.X * CellSize, Cell.Y * CellSize);
+    return HasAreaChangedInBounds(FBox2D(CellMin, CellMin + FVector2D(CellSize, CellSize)), SeenVersion);
+}
+
+bool UCattleAreaSubsystem::HasAreaChangedInBounds(const FBox2D &Bounds, uint32 SeenVersion) const
+{
+    if (SeenVersion == AreaLayoutVersion)
+    {
+        return false;
+    }
+
+    // Changes older than the log were dropped, so assume they matter
+    if (RecentAreaChanges.Num() == 0 || RecentAreaChanges[0].Version > SeenVersion + 1)
+    {
+        return true;
+    }
+
+    for (int32 i = RecentAreaChanges.Num() - 1; i >= 0 && RecentAreaChanges[i].Version > SeenVersion; --i)
+    {
+        const FBox2D &ChangeBounds = RecentAreaChanges[i].Bounds;
+        if (!ChangeBounds.bIsValid || ChangeBounds.Intersect(Bounds))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+float UCattleAreaSubsystem::ComputeSafeRadius(const FVector &Location)
+{
+    float SafeRadius = MaxCoherenceRadius;
+
+    // Only areas whose influence bounds reach the circle can be entered or left inside it
+    const FBox2D SearchBounds(FVector2D(Location) - FVector2D(SafeRadius), FVector2D(Location) + FVector2D(SafeRadius));
+    AreaGrid.GetItemsInBounds(SearchBounds, ScratchAreaIds);
+
+    for (const int32 Index : ScratchAreaIds)
+    {
+        if (ACattleAreaBase *Area = AreaSlots[Index].Area.Get())
+        {
+            SafeRadius = FMath::Min(SafeRadius, Area->GetMembershipMargin(Location));
+        }
+    }
+
+    return FMath::Max(SafeRadius, 0.0f);
+}
+
+FVector UCattleAreaSubsystem::GetTrackedFlowDirection(FTrackedAnimal &Tracked, const FVector &Location) const
+{
+    const float CellSize = FMath::Max(FlowCacheCellSize, 1.0f);
+    const FIntPoint FlowCell(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+    const FVector2D CellMin(FlowCell.X * CellSize, FlowCell.Y * CellSize);
+
+    // Flow guide registration is recorded as an area change, so the log also invalidates flow samples
+    if (Tracked.FlowVersion == 0 || FlowCell != Tracked.FlowCell || HasAreaChangedInBounds(FBox2D(CellMin, CellMin + FVector2D(CellSize, CellSize)), Tracked.FlowVersion))
+    {
+        Tracked.FlowDirection = GetFlowDirectionAtLocation(Location);
+        Tracked.FlowCell = FlowCell;
+    }
+
+    Tracked.FlowVersion = AreaLayoutVersion;
+    return Tracked.FlowDirection;
+}
+
+void UCattleAreaSubsystem::LaunchInfluenceBake()
+{
+    CATTLE_AREA_SCOPE(LaunchInfluenceBake);
+
+    TArray<FIntPoint> TileCoords;
+    InfluenceGrid.GetDirtyTiles(MaxTilesPerBake, TileCoords);
+    if (TileCoords.Num() == 0)
+    {
+        return;
+    }
+
+    TSharedPtr<FCattleAreaBakeBatch> Batch = MakeShared<FCattleAreaBakeBatch>();
+    Batch->CellSize = InfluenceGrid.GetCellSize();
+
+    // Snapshot every area touching the tiles; each area appears once however many tiles it spans
+    TMap<int32, int32> SourceByAreaIndex;
+    TArray<int32> AreaIndices;
+
+    for (const FIntPoint &TileCoord : TileCoords)
+    {
+        FCattleAreaBakeJob &Job = Batch->Jobs.AddDefaulted_GetRef();
+        Job.TileCoord = TileCoord;
+        Job.DirtyGeneration = InfluenceGrid.GetDirtyGeneration(TileCoord);
+
+        AreaGrid.GetItemsInBounds(InfluenceGrid.GetTileBounds(TileCoord), AreaIndices);
+
+        for (const int32 AreaIndex : AreaIndices)
+        {
+            ACattleAreaBase *Area = AreaSlots[AreaIndex].Area.Get();
+
+            // GetPrimaryAreaAtLocation never reports negative priorities
+            if (!Area || Area->GetEffectivePriority() < 0)
+            {
+                continue;
+            }
+
+            int32 *ExistingSource = SourceByAreaIndex.Find(AreaIndex);
+            if (!ExistingSource)
+            {
+                // The worker reads only these copies; the area may move, reshape or change its properties while the bake runs
+                FCattleAreaBakeSource &Source = Batch->Sources.AddDefaulted_GetRef();
+                Source.Area = AreaSlots[AreaIndex].Area;
+                Source.Shape = FCattleAreaShapeSnapshot(Area->GetShape());
+                Source.Params = Area->GetInfluenceParams();
+                Source.Bounds = Area->GetAreaBounds2D();
+                Source.Order = AreaIndex;
+                Source.bCanBake = Area->CanBakeInfluence();
+                Area->GetHeightRange(Source.MinZ, Source.MaxZ);
+
+                // Boxes also clip height by their own extent
+                if (const UBoxComponent *Box = Area->GetShapeBox())
+                {
+                    const FBox BoxBounds = Box->Bounds.GetBox();
+                    Source.MinZ = FMath::Max(Source.MinZ, static_cast<float>(BoxBounds.Min.Z));
+                    Source.MaxZ = FMath::Min(Source.MaxZ, static_cast<float>(BoxBounds.Max.Z));
+                }
+
+                ExistingSource = &SourceByAreaIndex.Add(AreaIndex, Batch->Sources.Num() - 1);
+            }
+
+            Job.SourceIndices.Add(*ExistingSource);
+        }
+    }
+
+    // Highest priority first, ties to the lowest slot, matching the live query
+    for (FCattleAreaBakeJob &Job : Batch->Jobs)
+    {
+        Job.SourceIndices.Sort([&Sources = Batch->Sources](int32 A, int32 B)
+                               { return Sources[A].Params.Priority != Sources[B].Params.Priority ? Sources[A].Params.Priority > Sources[B].Params.Priority : Sources[A].Order < Sources[B].Order; });
+    }
+
+    PendingBake = Batch;
+    PendingBakeTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Batch]()
+                                        {
+        for (FCattleAreaBakeJob &Job : Batch->Jobs)
+        {
+            FCattleAreaInfluenceGrid::BakeJob(*Batch, Job);
+        } });
+}
+
+void UCattleAreaSubsystem::FlushInfluenceBake()
+{
+    if (!PendingBake.IsValid())
+    {
+        return;
+    }
+
+    CATTLE_AREA_SCOPE(FlushInfluenceBake);
+
+    PendingBakeTask.Wait();
+    InfluenceGrid.ApplyBake(*PendingBake);
+
+    PendingBake.Reset();
+    PendingBakeTask = UE::Tasks::FTask();
 }
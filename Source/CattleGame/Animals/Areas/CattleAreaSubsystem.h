@@ -4,6 +4,10 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "CattleAreaSpatialGrid.h"
+#include "CattleAreaInfluenceGrid.h"
+#include "CattleAreaStats.h"
 #include "CattleAreaSubsystem.generated.h"
 
 class ACattleAreaBase;
@@ -62,14 +66,63 @@ struct CATTLEGAME_API FCattleAreaInfluence
     bool IsValid() const { return AreaType != ECattleAreaType::None && AreaActor.IsValid(); }
 };
 
+/**
+ * FCattleAreaHandle
+ *
+ * Identifies an area's registration slot in the subsystem. The serial guards
+ * against a slot being reused after the area it referred to unregistered.
+ */
+struct FCattleAreaHandle
+{
+    int32 Index = INDEX_NONE;
+    uint32 Serial = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+
+    bool operator==(const FCattleAreaHandle &Other) const { return Index == Other.Index && Serial == Other.Serial; }
+    bool operator!=(const FCattleAreaHandle &Other) const { return !(*this == Other); }
+};
+
+/**
+ * FCattleAreaHit
+ *
+ * Compact influence result for the allocation-free queries. Refers to its area
+ * by handle; resolve it with UCattleAreaSubsystem::ResolveAreaHandle when the
+ * actor itself is needed.
+ */
+struct FCattleAreaHit
+{
+    FCattleAreaHandle Handle;
+    ECattleAreaType AreaType = ECattleAreaType::None;
+    int32 Priority = 0;
+    float Strength = 0.0f;
+    float SpeedModifier = 1.0f;
+    FVector InfluenceDirection = FVector::ZeroVector;
+
+    bool IsValid() const { return AreaType != ECattleAreaType::None; }
+};
+
 /**
  * UCattleAreaSubsystem
  *
  * World subsystem that manages all cattle behavior areas and provides
  * efficient spatial queries for animals to determine their current influences.
+ *
+ * Areas are indexed by their XY bounds in a uniform grid, so a point query only
+ * tests the areas overlapping the point's cell instead of every registered area.
+ *
+ * With bUseBakedInfluenceGrid enabled, primary influences are additionally
+ * rasterized into a tiled world grid that is rebaked in the background whenever
+ * areas register, unregister or move, so most lookups are a single cell fetch.
+ *
+ * Dynamic areas (bDynamicArea) live in their own grid that is updated in place
+ * as they move; they are never baked and never invalidate baked tiles. Short-lived
+ * dynamic areas can be taken from a per-class pool with AcquireTransientArea.
+ *
+ * Query costs are reported under "stat CattleAreas" and the CattleAreas CSV category.
  */
-UCLASS()
-class CATTLEGAME_API UCattleAreaSubsystem : public UWorldSubsystem
+UCLASS(Config = Game)
+class CATTLEGAME_API UCattleAreaSubsystem : public UTickableWorldSubsystem
 {
     GENERATED_BODY()
 
@@ -79,6 +132,8 @@ public:
     virtual void Initialize(FSubsystemCollectionBase &Collection) override;
     virtual void Deinitialize() override;
     virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
 
     // ===== Area Registration =====
 
@@ -108,6 +163,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Cattle Area")
     FCattleAreaInfluence GetPrimaryAreaAtLocation(const FVector &Location) const;
 
+    /**
+     * Get the highest priority area influence for each location in one pass.
+     * Same result as calling GetPrimaryAreaAtLocation per location, but shape tests
+     * run on four locations at a time and each area is prepared once per batch.
+     */
+    void GetPrimaryAreasAtLocations(TConstArrayView<FVector> Locations, TArray<FCattleAreaInfluence> &OutInfluences) const;
+
     /** Get flow direction at a world location (samples all flow guides) */
     UFUNCTION(BlueprintCallable, Category = "Cattle Area")
     FVector GetFlowDirectionAtLocation(const FVector &Location) const;
@@ -120,16 +182,158 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Cattle Area")
     TArray<ACattleAreaBase *> GetAreasOfType(ECattleAreaType AreaType) const;
 
+    // ===== Allocation-Free Queries =====
+
+    /** Area registered under a handle, or nullptr if it has since unregistered */
+    ACattleAreaBase *ResolveAreaHandle(const FCattleAreaHandle &Handle) const;
+
+    /** Call Visitor for every area influencing a location, in no particular order */
+    void VisitAreasAtLocation(const FVector &Location, TFunctionRef<void(const FCattleAreaHit &)> Visitor) const;
+
+    /** Fill OutHits with every area influencing a location, highest priority first (ties to the lowest slot) */
+    template <typename AllocatorType>
+    void GetAreasAtLocation(const FVector &Location, TArray<FCattleAreaHit, AllocatorType> &OutHits) const
+    {
+        OutHits.Reset();
+        VisitAreasAtLocation(Location, [&OutHits](const FCattleAreaHit &Hit)
+                             { OutHits.Add(Hit); });
+
+        OutHits.Sort([](const FCattleAreaHit &A, const FCattleAreaHit &B)
+                     { return A.Priority != B.Priority ? A.Priority > B.Priority : A.Handle.Index < B.Handle.Index; });
+    }
+
+    /** Call Visitor for every registered area of a type */
+    void VisitAreasOfType(ECattleAreaType AreaType, TFunctionRef<void(ACattleAreaBase *)> Visitor) const;
+
+    /** Fill OutAreas with every registered area of a type */
+    template <typename AllocatorType>
+    void GetAreasOfType(ECattleAreaType AreaType, TArray<ACattleAreaBase *, AllocatorType> &OutAreas) const
+    {
+        OutAreas.Reset();
+        VisitAreasOfType(AreaType, [&OutAreas](ACattleAreaBase *Area)
+                         { OutAreas.Add(Area); });
+    }
+
     // ===== Debug =====
 
     /** Draw debug visualization for all areas */
     UFUNCTION(BlueprintCallable, Category = "Cattle Area|Debug")
     void DrawDebugAreas(float Duration = 0.0f) const;
 
+    // ===== Spatial Index =====
+
+    /** Size of a spatial index cell in world units */
+    UPROPERTY(Config)
+    float AreaGridCellSize = 2000.0f;
+
+    /** Re-index an area after its shape or transform changed */
+    void UpdateAreaBounds(ACattleAreaBase *Area);
+
+    // ===== Transient Areas =====
+
+    /**
+     * Get a dynamic area of the given class at Transform, reusing a released one when possible.
+     * The area is released automatically after Lifetime seconds (never if Lifetime <= 0).
+     * Pooled areas keep the properties they had when released, so configure them after acquiring.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cattle Area", meta = (DeterminesOutputType = "AreaClass"))
+    ACattleAreaBase *AcquireTransientArea(TSubclassOf<ACattleAreaBase> AreaClass, const FTransform &Transform, float Lifetime = 0.0f);
+
+    /** Unregister and hide a transient area and return it to the pool */
+    UFUNCTION(BlueprintCallable, Category = "Cattle Area")
+    void ReleaseTransientArea(ACattleAreaBase *Area);
+
+    // ===== Baked Influence Grid =====
+
+    /** Answer primary-area queries from the baked influence grid where possible */
+    UPROPERTY(Config)
+    bool bUseBakedInfluenceGrid = false;
+
+    /** Size of a baked influence cell in world units */
+    UPROPERTY(Config)
+    float BakedCellSize = 100.0f;
+
+    /** Maximum number of tiles handed to one background bake */
+    UPROPERTY(Config)
+    int32 MaxTilesPerBake = 8;
+
+    // ===== Animal Tracking =====
+
+    /** Size of the cells animals are tracked in; membership is only re-evaluated when an animal changes cell */
+    UPROPERTY(Config)
+    float AnimalTrackingCellSize = 200.0f;
+
+    /**
+     * Upper bound on how far an animal may move before its areas are searched again, when
+     * it is provably still inside the same areas. Larger values test more areas per search.
+     */
+    UPROPERTY(Config)
+    float MaxCoherenceRadius = 1000.0f;
+
+    /** Size of the cells a tracked animal's flow direction is cached for */
+    UPROPERTY(Config)
+    float FlowCacheCellSize = 400.0f;
+
+    /** Start tracking an animal's area membership and evaluate it immediately */
+    void TrackAnimal(ACattleAnimal *Animal);
+
+    /** Stop tracking an animal */
+    void UntrackAnimal(ACattleAnimal *Animal);
+
+    /**
+     * Re-evaluate a tracked animal's areas if it moved to a new tracking cell or an area
+     * near it changed (or always, if bForce). Fires the animal's enter/exit events.
+     * While the animal is provably inside the same areas as at its last search, only its
+     * cached primary area is queried. Returns true if the animal was re-evaluated.
+     */
+    bool RefreshTrackedAnimal(ACattleAnimal *Animal, bool bForce = false);
+
 protected:
-    /** All registered behavior areas */
-    UPROPERTY()
-    TArray<TWeakObjectPtr<ACattleAreaBase>> RegisteredAreas;
+    /** A registration slot */
+    struct FRegisteredArea
+    {
+        TWeakObjectPtr<ACattleAreaBase> Area;
+        uint32 Serial = 0;
+        bool bDynamic = false;
+    };
+
+    /** All registered behavior areas; slot indices are stable and double as the spatial index item ids */
+    TSparseArray<FRegisteredArea> AreaSlots;
+
+    /** Serial handed to the next registration */
+    uint32 NextAreaSerial = 1;
+
+    /** Spatial index over the XY bounds of static areas */
+    FCattleAreaSpatialGrid AreaGrid;
+
+    /** Spatial index over the XY bounds of dynamic areas */
+    FCattleAreaSpatialGrid DynamicAreaGrid;
+
+    /** Slot an area is registered in, or INDEX_NONE */
+    int32 FindAreaSlot(const ACattleAreaBase *Area) const;
+
+    /** Call Func(SlotIndex, Area) for every static and dynamic area whose indexed bounds contain the location */
+    template <typename FuncType>
+    void ForEachAreaAtLocation(const FVector &Location, FuncType &&Func) const
+    {
+        int32 NumTested = 0;
+        auto Visit = [this, &Func, &NumTested](int32 Index)
+        {
+            if (ACattleAreaBase *Area = AreaSlots[Index].Area.Get())
+            {
+                ++NumTested;
+                Func(Index, Area);
+            }
+        };
+
+        AreaGrid.ForEachItemAtLocation(FVector2D(Location), Visit);
+        DynamicAreaGrid.ForEachItemAtLocation(FVector2D(Location), Visit);
+
+        FrameCounters.CountAreasTested(NumTested);
+    }
+
+    /** Whether any dynamic area's indexed bounds contain the location */
+    bool IsNearDynamicArea(const FVector &Location) const;
 
     /** All registered flow guides */
     UPROPERTY()
@@ -137,4 +341,121 @@ protected:
 
     /** Clean up invalid (destroyed) area references */
     void CleanupInvalidReferences();
+
+    /** Rebuild the spatial indices from AreaSlots */
+    void RebuildAreaGrid();
+
+    /** Primary influence computed directly from the registered areas (static and dynamic) */
+    FCattleAreaInfluence GetPrimaryAreaAtLocationLive(const FVector &Location) const;
+
+    /** Pre-resolved primary influences, rebaked tile by tile */
+    FCattleAreaInfluenceGrid InfluenceGrid;
+
+    /** Bake currently running in the background, if any */
+    TSharedPtr<FCattleAreaBakeBatch> PendingBake;
+    UE::Tasks::FTask PendingBakeTask;
+
+    /** Record that a static area's indexed bounds changed: rebake tiles and re-evaluate tracked animals under them */
+    void MarkAreaDirty(int32 AreaIndex);
+
+    // ===== Transient Areas =====
+
+    /** A transient area handed out by AcquireTransientArea */
+    struct FActiveTransientArea
+    {
+        TWeakObjectPtr<ACattleAreaBase> Area;
+
+        /** World time to release at (0 = only on ReleaseTransientArea) */
+        double ExpireTime = 0.0;
+    };
+
+    TArray<FActiveTransientArea> ActiveTransientAreas;
+
+    /** Released transient areas waiting to be reused */
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<ACattleAreaBase>> FreeTransientAreas;
+
+    /** Release transient areas whose lifetime ran out */
+    void ReleaseExpiredTransientAreas();
+
+    // ===== Animal Tracking =====
+
+    /** Per-animal tracking state */
+    struct FTrackedAnimal
+    {
+        FIntVector Cell = FIntVector::ZeroValue;
+
+        /** AreaLayoutVersion when the animal was last evaluated (0 = never) */
+        uint32 LayoutVersion = 0;
+
+        /** Areas whose influence contained the animal at its last evaluation */
+        TArray<TWeakObjectPtr<ACattleAreaBase>, TInlineAllocator<4>> Areas;
+
+        /** Whether any of Areas is dynamic; such animals re-evaluate every refresh since dynamic moves are not recorded */
+        bool bInDynamicArea = false;
+
+        /** Location of the last full search */
+        FVector SearchLocation = FVector::ZeroVector;
+
+        /** Distance from SearchLocation within which no area can be entered or left */
+        float SafeRadius = 0.0f;
+
+        /** Primary area found by the last full search */
+        FCattleAreaHandle PrimaryHandle;
+
+        /** Cached flow direction, the flow cell it was sampled in and the layout version it is valid for (0 = none) */
+        FVector FlowDirection = FVector::ZeroVector;
+        FIntPoint FlowCell = FIntPoint::ZeroValue;
+        uint32 FlowVersion = 0;
+    };
+
+    /** A region where areas changed, stamped with the layout version it produced */
+    struct FAreaChange
+    {
+        uint32 Version = 0;
+
+        /** Invalid bounds mean the change may affect every location */
+        FBox2D Bounds = FBox2D(ForceInit);
+    };
+
+    /** Number of recent area changes kept for tracked animals to compare against */
+    static constexpr int32 MaxRecordedAreaChanges = 64;
+
+    TMap<TWeakObjectPtr<ACattleAnimal>, FTrackedAnimal> TrackedAnimals;
+
+    /** Incremented on every static area change */
+    uint32 AreaLayoutVersion = 1;
+
+    /** Most recent area changes, oldest first */
+    TArray<FAreaChange> RecentAreaChanges;
+
+    /** Bump the layout version and remember where it changed */
+    void RecordAreaChange(const FBox2D &Bounds);
+
+    /** Tracking cell containing a location */
+    FIntVector GetTrackingCell(const FVector &Location) const;
+
+    /** Whether any area change since SeenVersion overlaps a tracking cell */
+    bool HasAreaChangedInCell(const FIntVector &Cell, uint32 SeenVersion) const;
+
+    /** Whether any area change since SeenVersion overlaps the bounds */
+    bool HasAreaChangedInBounds(const FBox2D &Bounds, uint32 SeenVersion) const;
+
+    /** Radius around Location within which no static area can be entered or left */
+    float ComputeSafeRadius(const FVector &Location);
+
+    /** Flow direction at Location, reusing the animal's cached sample while it stays in the same flow cell */
+    FVector GetTrackedFlowDirection(FTrackedAnimal &Tracked, const FVector &Location) const;
+
+    /** Scratch buffer for grid queries made on the game thread */
+    TArray<int32> ScratchAreaIds;
+
+    /** This world's query counters; mutable so const queries can count themselves */
+    mutable FCattleAreaFrameCounters FrameCounters;
+
+    /** Start a background bake for the next dirty tiles */
+    void LaunchInfluenceBake();
+
+    /** Wait for the running bake and apply the tiles that have not been dirtied again since it launched */
+    void FlushInfluenceBake();
 };
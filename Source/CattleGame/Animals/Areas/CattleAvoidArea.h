@@ -49,12 +49,11 @@ public:
 
     // ===== Overrides =====
 
-    virtual bool IsLocationInArea(const FVector &Location) const override;
-    virtual FCattleAreaInfluence GetInfluenceAtLocation(const FVector &Location) const override;
     virtual float GetSpeedModifier() const override { return InsideSpeedModifier; }
-    virtual FVector GetInfluenceDirection(const FVector &Location) const override;
+    virtual FCattleAreaInfluenceParams GetInfluenceParams() const override;
+    virtual float GetInfluenceReachBeyondShape() const override;
 
 protected:
-    /** Get direction away from area boundary */
-    FVector GetAvoidanceDirection(const FVector &Location) const;
+    virtual float GetDistanceFieldMargin() const override { return FMath::Max(EdgeFalloff, AvoidanceRadius); }
+    virtual float GetMembershipDistance() const override { return AvoidanceRadius; }
 };
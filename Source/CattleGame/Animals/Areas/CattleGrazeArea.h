@@ -45,9 +45,5 @@ public:
     // ===== Overrides =====
 
     virtual float GetSpeedModifier() const override { return GrazeSpeedModifier; }
-    virtual FVector GetInfluenceDirection(const FVector &Location) const override;
-
-protected:
-    /** Get direction toward center of area to encourage staying */
-    FVector GetContainmentDirection(const FVector &Location) const;
+    virtual FCattleAreaInfluenceParams GetInfluenceParams() const override;
 };
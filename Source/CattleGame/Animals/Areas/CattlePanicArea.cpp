@@ -1,7 +1,6 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "CattlePanicArea.h"
-#include "Components/SplineComponent.h"
 #include "Components/BoxComponent.h"
 
 ACattlePanicArea::ACattlePanicArea()
@@ -22,46 +21,11 @@ ACattlePanicArea::ACattlePanicArea()
     EdgeFalloff = 400.0f;
 }
 
-FVector ACattlePanicArea::GetInfluenceDirection(const FVector &Location) const
+FCattleAreaInfluenceParams ACattlePanicArea::GetInfluenceParams() const
 {
-    return GetFleeDirection(Location) * FleeStrength;
-}
-
-FVector ACattlePanicArea::GetFleeDirection(const FVector &Location) const
-{
-    if (bRandomFleeDirection)
-    {
-        // Random direction for stampede chaos
-        const float RandomAngle = FMath::FRand() * 360.0f;
-        return FVector(FMath::Cos(FMath::DegreesToRadians(RandomAngle)), FMath::Sin(FMath::DegreesToRadians(RandomAngle)), 0.0f);
-    }
-
-    FVector ThreatCenter;
-
-    if (bUseSplineShape && SplineComponent)
-    {
-        // Find closest point on spline as threat source
-        ThreatCenter = SplineComponent->FindLocationClosestToWorldLocation(Location, ESplineCoordinateSpace::World);
-    }
-    else if (BoxComponent)
-    {
-        ThreatCenter = BoxComponent->GetComponentLocation();
-    }
-    else
-    {
-        ThreatCenter = GetActorLocation();
-    }
-
-    // Direction away from threat
-    FVector FleeDir = Location - ThreatCenter;
-    FleeDir.Z = 0.0f; // Keep horizontal
-
-    // If at center, pick a random direction
-    if (FleeDir.IsNearlyZero())
-    {
-        const float RandomAngle = FMath::FRand() * 360.0f;
-        return FVector(FMath::Cos(FMath::DegreesToRadians(RandomAngle)), FMath::Sin(FMath::DegreesToRadians(RandomAngle)), 0.0f);
-    }
-
-    return FleeDir.GetSafeNormal();
+    FCattleAreaInfluenceParams Params = Super::GetInfluenceParams();
+    Params.DirectionMode = ECattleAreaDirectionMode::Flee;
+    Params.DirectionStrength = FleeStrength;
+    Params.bRandomDirection = bRandomFleeDirection;
+    return Params;
 }
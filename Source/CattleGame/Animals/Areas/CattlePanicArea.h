@@ -50,9 +50,6 @@ public:
     // ===== Overrides =====
 
     virtual float GetSpeedModifier() const override { return PanicSpeedModifier; }
-    virtual FVector GetInfluenceDirection(const FVector &Location) const override;
-
-protected:
-    /** Get direction away from area center/threat */
-    FVector GetFleeDirection(const FVector &Location) const;
+    virtual FCattleAreaInfluenceParams GetInfluenceParams() const override;
+    virtual bool CanBakeInfluence() const override { return !bRandomFleeDirection; }
 };
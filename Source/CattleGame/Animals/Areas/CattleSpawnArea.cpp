@@ -59,6 +59,9 @@ void ACattleSpawnArea::OnConstruction(const FTransform &Transform)
 {
     Super::OnConstruction(Transform);
     UpdateShapeVisibility();
+
+    // Spline points may have been edited
+    SplinePolygon.Invalidate();
 }
 
 #if WITH_EDITOR
@@ -66,6 +69,8 @@ void ACattleSpawnArea::PostEditChangeProperty(FPropertyChangedEvent &PropertyCha
 {
     Super::PostEditChangeProperty(PropertyChangedEvent);
 
+    SplinePolygon.Invalidate();
+
     if (PropertyChangedEvent.Property)
     {
         const FName PropertyName = PropertyChangedEvent.Property->GetFName();
@@ -283,38 +288,18 @@ void ACattleSpawnArea::DrawDebugSpawnArea(float Duration) const
 
 bool ACattleSpawnArea::IsInsideSplineArea(const FVector &Location) const
 {
-    if (!SplineComponent || SplineComponent->GetNumberOfSplinePoints() < 3)
+    if (!SplineComponent)
     {
         return false;
     }
 
-    // Use ray casting algorithm
-    int32 Intersections = 0;
-    const int32 NumPoints = SplineComponent->GetNumberOfSplinePoints();
-    const int32 SamplesPerSegment = 10;
-    const int32 TotalSamples = NumPoints * SamplesPerSegment;
-
-    for (int32 i = 0; i < TotalSamples; ++i)
-    {
-        const float T1 = static_cast<float>(i) / TotalSamples;
-        const float T2 = static_cast<float>(i + 1) / TotalSamples;
-
-        const FVector P1 = SplineComponent->GetLocationAtTime(T1, ESplineCoordinateSpace::World, true);
-        const FVector P2 = SplineComponent->GetLocationAtTime(T2, ESplineCoordinateSpace::World, true);
-
-        if ((P1.Y <= Location.Y && P2.Y > Location.Y) || (P2.Y <= Location.Y && P1.Y > Location.Y))
-        {
-            const float T = (Location.Y - P1.Y) / (P2.Y - P1.Y);
-            const float IntersectX = P1.X + T * (P2.X - P1.X);
-
-            if (IntersectX > Location.X)
-            {
-                Intersections++;
-            }
-        }
-    }
+    return GetSplinePolygon().Contains(FVector2D(Location));
+}
 
-    return (Intersections % 2) == 1;
+const FCattleAreaPolygon &ACattleSpawnArea::GetSplinePolygon() const
+{
+    SplinePolygon.Update(SplineComponent);
+    return SplinePolygon;
 }
 
 bool ACattleSpawnArea::IsInsideBoxArea(const FVector &Location) const
@@ -355,14 +340,8 @@ FVector ACattleSpawnArea::GetRandomPointInSpline() const
         return GetActorLocation();
     }
 
-    // Calculate bounding box of spline
-    FBox SplineBounds(ForceInit);
-    const int32 NumSamples = 50;
-    for (int32 i = 0; i <= NumSamples; ++i)
-    {
-        const float T = static_cast<float>(i) / NumSamples;
-        SplineBounds += SplineComponent->GetLocationAtTime(T, ESplineCoordinateSpace::World, true);
-    }
+    // Bounding box of the cached spline polygon
+    const FBox2D SplineBounds = GetSplinePolygon().GetBounds();
 
     // Try random points until we find one inside
     for (int32 Attempt = 0; Attempt < MaxSpawnAttempts; ++Attempt)
@@ -379,7 +358,7 @@ FVector ACattleSpawnArea::GetRandomPointInSpline() const
     }
 
     // Fallback: return center of bounding box
-    return SplineBounds.GetCenter();
+    return FVector(SplineBounds.GetCenter(), GetActorLocation().Z);
 }
 
 bool ACattleSpawnArea::IsLocationFarEnoughFromOthers(const FVector &Location) const
@@ -411,17 +390,11 @@ TArray<FVector> ACattleSpawnArea::GenerateEvenlyDistributedPoints(int32 Count) c
             return Points;
         }
 
-        // Calculate bounding box
-        FBox SplineBounds(ForceInit);
-        const int32 NumSamples = 50;
-        for (int32 i = 0; i <= NumSamples; ++i)
-        {
-            const float T = static_cast<float>(i) / NumSamples;
-            SplineBounds += SplineComponent->GetLocationAtTime(T, ESplineCoordinateSpace::World, true);
-        }
+        // Bounding box of the cached spline polygon
+        const FBox2D SplineBounds = GetSplinePolygon().GetBounds();
 
         // Calculate ideal spacing based on area and count
-        const FVector BoundsSize = SplineBounds.GetSize();
+        const FVector2D BoundsSize = SplineBounds.GetSize();
         const float ApproxArea = BoundsSize.X * BoundsSize.Y * 0.7f; // Assume ~70% fill
         const float IdealSpacing = FMath::Sqrt(ApproxArea / Count) * 0.8f;
         const float ActualSpacing = FMath::Max(IdealSpacing, MinSpawnDistance);
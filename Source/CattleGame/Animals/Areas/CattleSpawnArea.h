@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "CattleAreaPolygon.h"
 #include "CattleSpawnArea.generated.h"
 
 class ACattleAnimal;
@@ -163,6 +164,9 @@ protected:
     /** Check if point is inside spline area */
     bool IsInsideSplineArea(const FVector &Location) const;
 
+    /** Get the cached spline polygon, re-transforming it if the spline moved */
+    const FCattleAreaPolygon &GetSplinePolygon() const;
+
     /** Check if point is inside box area */
     bool IsInsideBoxArea(const FVector &Location) const;
 
@@ -180,4 +184,8 @@ protected:
 
     /** Update component visibility based on shape mode */
     void UpdateShapeVisibility();
+
+private:
+    /** Tessellated spline shape, built lazily on first query */
+    mutable FCattleAreaPolygon SplinePolygon;
 };
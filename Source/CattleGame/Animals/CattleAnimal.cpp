@@ -7,14 +7,18 @@
 #include "CattleGame/AbilitySystem/CattleAbilitySystemComponent.h"
 #include "CattleGame/AbilitySystem/AnimalAttributeSet.h"
 #include "Areas/CattleAreaSubsystem.h"
+#include "Herd/CattleHerdSubsystem.h"
+#include "Tick/CattleTickSubsystem.h"
+#include "Dormancy/CattleDormancySubsystem.h"
+#include "Fear/CattleFearFieldSubsystem.h"
 #include "GameplayAbilitySpec.h"
 #include "GameplayEffect.h"
 
 ACattleAnimal::ACattleAnimal(const FObjectInitializer &ObjectInitializer)
 	: Super(ObjectInitializer.SetDefaultSubobjectClass<UCattleAnimalMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
-	// Enable tick
-	PrimaryActorTick.bCanEverTick = true;
+	// Per-frame state is advanced by UCattleTickSubsystem instead of an actor tick
+	PrimaryActorTick.bCanEverTick = false;
 
 	// Get reference to custom movement component
 	AnimalMovement = Cast<UCattleAnimalMovementComponent>(GetCharacterMovement());
@@ -45,10 +49,12 @@ void ACattleAnimal::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Cache the area subsystem
+	// Cache the area, tick and fear field subsystems
 	if (UWorld *World = GetWorld())
 	{
 		CachedAreaSubsystem = World->GetSubsystem<UCattleAreaSubsystem>();
+		CachedTickSubsystem = World->GetSubsystem<UCattleTickSubsystem>();
+		CachedFearFieldSubsystem = World->GetSubsystem<UCattleFearFieldSubsystem>();
 	}
 
 	// Bind lasso capture/release delegates
@@ -66,23 +72,43 @@ void ACattleAnimal::BeginPlay()
 	{
 		AnimalMovement->SetMovementMode_Walking();
 	}
+
+	// Start event-driven area tracking (evaluates the starting location immediately)
+	if (CachedAreaSubsystem)
+	{
+		CachedAreaSubsystem->TrackAnimal(this);
+	}
+
+	// Make this animal visible to herd queries
+	if (UCattleHerdSubsystem *HerdSubsystem = GetWorld()->GetSubsystem<UCattleHerdSubsystem>())
+	{
+		HerdSubsystem->RegisterAnimal(this);
+	}
+
+	if (CachedTickSubsystem)
+	{
+		CachedTickSubsystem->RegisterAnimal(this);
+	}
 }
 
-void ACattleAnimal::Tick(float DeltaTime)
+void ACattleAnimal::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::Tick(DeltaTime);
+	if (CachedAreaSubsystem)
+	{
+		CachedAreaSubsystem->UntrackAnimal(this);
+	}
+
+	if (UCattleHerdSubsystem *HerdSubsystem = GetWorld()->GetSubsystem<UCattleHerdSubsystem>())
+	{
+		HerdSubsystem->UnregisterAnimal(this);
+	}
 
-	// Update area influences periodically
-	AreaUpdateTimer += DeltaTime;
-	if (AreaUpdateTimer >= AreaUpdateInterval)
+	if (CachedTickSubsystem)
 	{
-		AreaUpdateTimer = 0.0f;
-		UpdateAreaInfluences();
+		CachedTickSubsystem->UnregisterAnimal(this);
 	}
 
-	// Process influences and decay fear
-	ProcessAreaInfluences(DeltaTime);
-	DecayFear(DeltaTime);
+	Super::EndPlay(EndPlayReason);
 }
 
 void ACattleAnimal::SetupPlayerInputComponent(UInputComponent *PlayerInputComponent)
@@ -163,21 +189,19 @@ void ACattleAnimal::ApplyDefaultEffects()
 
 void ACattleAnimal::UpdateAreaInfluences()
 {
-	if (!CachedAreaSubsystem)
+	if (CachedAreaSubsystem)
 	{
-		return;
+		CachedAreaSubsystem->RefreshTrackedAnimal(this);
 	}
+}
 
-	const FVector Location = GetActorLocation();
-
-	// Get primary area influence (highest priority)
-	CurrentInfluence = CachedAreaSubsystem->GetPrimaryAreaAtLocation(Location);
+void ACattleAnimal::ApplyAreaEvaluation(const FCattleAreaInfluence &Influence, const FVector &FlowDirection)
+{
+	CurrentInfluence = Influence;
 
-	// Also get flow direction
 	if (AnimalMovement)
 	{
-		const FVector FlowDir = CachedAreaSubsystem->GetFlowDirectionAtLocation(Location);
-		AnimalMovement->SetFlowDirection(FlowDir);
+		AnimalMovement->SetFlowDirection(FlowDirection);
 	}
 }
 
@@ -211,11 +235,11 @@ void ACattleAnimal::ProcessAreaInfluences(float DeltaTime)
 	}
 }
 
-void ACattleAnimal::DecayFear(float DeltaTime)
+float ACattleAnimal::GetFearDecay(float DeltaTime) const
 {
 	if (!AnimalAttributes)
 	{
-		return;
+		return 0.0f;
 	}
 
 	const float CurrentFear = AnimalAttributes->GetFear();
@@ -230,14 +254,19 @@ void ACattleAnimal::DecayFear(float DeltaTime)
 			DecayRate *= 2.0f;
 		}
 
-		const float NewFear = FMath::Max(0.0f, CurrentFear - DecayRate * DeltaTime);
-		AnimalAttributes->SetFear(NewFear);
+		return FMath::Clamp(DecayRate * DeltaTime, 0.0f, CurrentFear);
 	}
+	return 0.0f;
 }
 
 void ACattleAnimal::ApplyPhysicsImpulse(FVector Impulse, bool bVelocityChange)
 {
-	if (AnimalMovement)
+	// Buffered and resolved in one batch before movement; the tick subsystem also wakes dormant animals
+	if (CachedTickSubsystem)
+	{
+		CachedTickSubsystem->QueueImpulse(this, Impulse, bVelocityChange);
+	}
+	else if (AnimalMovement)
 	{
 		AnimalMovement->AddPhysicsImpulse(Impulse, bVelocityChange);
 	}
@@ -247,10 +276,18 @@ void ACattleAnimal::AddFear(float Amount)
 {
 	if (AnimalAttributes && Amount > 0.0f)
 	{
+		WakeFromDormancy();
+
 		const float CurrentFear = AnimalAttributes->GetFear();
 		const float MaxFear = AnimalAttributes->GetMaxFear();
 		const float NewFear = FMath::Clamp(CurrentFear + Amount, 0.0f, MaxFear);
 		AnimalAttributes->SetFear(NewFear);
+
+		// Lets the field pick up new sources of panic while it holds no fear
+		if (CachedFearFieldSubsystem)
+		{
+			CachedFearFieldSubsystem->OnFearAdded(this);
+		}
 	}
 }
 
@@ -288,9 +325,21 @@ float ACattleAnimal::GetFearPercent() const
 	return 0.0f;
 }
 
+void ACattleAnimal::WakeFromDormancy()
+{
+	if (bIsDormant)
+	{
+		if (UCattleDormancySubsystem *DormancySubsystem = GetWorld()->GetSubsystem<UCattleDormancySubsystem>())
+		{
+			DormancySubsystem->WakeAnimal(this);
+		}
+	}
+}
+
 void ACattleAnimal::OnLassoCaptured(AActor *LassoOwner)
 {
 	bIsLassoed = true;
+	WakeFromDormancy();
 
 	// Add fear when captured
 	AddFear(LassoFearAmount);
@@ -12,6 +12,12 @@ class ULassoableComponent;
 class UCattleAnimalMovementComponent;
 class UCattleAbilitySystemComponent;
 class UAnimalAttributeSet;
+class ACattleAreaBase;
+class UCattleHerdSubsystem;
+class UCattleSignificanceSubsystem;
+class UCattleTickSubsystem;
+class UCattleDormancySubsystem;
+class UCattleFearFieldSubsystem;
 
 /**
  * ACattleAnimal
@@ -47,7 +53,7 @@ public:
 
 	// ===== Area Influence =====
 
-	/** Update area influences based on current location */
+	/** Update area influences if the animal moved to a new tracking cell or nearby areas changed */
 	UFUNCTION(BlueprintCallable, Category = "Cattle Animal|Area")
 	void UpdateAreaInfluences();
 
@@ -55,10 +61,38 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Cattle Animal|Area")
 	FCattleAreaInfluence GetCurrentAreaInfluence() const;
 
-	/** Apply a physics impulse to the animal (e.g., from lasso, explosion) */
+	/** Store the result of an area evaluation (called by UCattleAreaSubsystem) */
+	void ApplyAreaEvaluation(const FCattleAreaInfluence &Influence, const FVector &FlowDirection);
+
+	// ===== Area Events =====
+
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FCattleAreaTransitionDelegate, ACattleAnimal *, Animal, ACattleAreaBase *, Area);
+
+	/** Broadcast when the animal enters an area's influence (after the current influence is updated) */
+	UPROPERTY(BlueprintAssignable, Category = "Cattle Animal|Area")
+	FCattleAreaTransitionDelegate OnAreaEntered;
+
+	/** Broadcast when the animal leaves an area's influence (after the current influence is updated) */
+	UPROPERTY(BlueprintAssignable, Category = "Cattle Animal|Area")
+	FCattleAreaTransitionDelegate OnAreaExited;
+
+	/** Apply a physics impulse to the animal (e.g., from lasso, explosion) before its next movement update; safe to call from any thread */
 	UFUNCTION(BlueprintCallable, Category = "Cattle Animal")
 	void ApplyPhysicsImpulse(FVector Impulse, bool bVelocityChange = false);
 
+	// ===== Herd =====
+
+	/** Slot in the herd subsystem's spatial index (INDEX_NONE while unregistered) */
+	int32 GetHerdIndex() const { return HerdIndex; }
+
+	// ===== Significance =====
+
+	/** Significance tier assigned by UCattleSignificanceSubsystem (0 = full update rate) */
+	int32 GetSignificanceTier() const { return SignificanceTier; }
+
+	/** Multiplier the current tier applies to behavior and area update intervals */
+	float GetSignificanceIntervalScale() const { return SignificanceIntervalScale; }
+
 	// ===== Fear/Panic System =====
 
 	/** Add fear to the animal (triggers panic at threshold) */
@@ -91,9 +125,19 @@ public:
 	UFUNCTION()
 	void OnLassoReleased();
 
+	// ===== Dormancy =====
+
+	/** Whether the animal is asleep and costs nothing per frame (see UCattleDormancySubsystem) */
+	UFUNCTION(BlueprintCallable, Category = "Cattle Animal|Dormancy")
+	bool IsDormant() const { return bIsDormant; }
+
+	/** Wake the animal if it is dormant */
+	UFUNCTION(BlueprintCallable, Category = "Cattle Animal|Dormancy")
+	void WakeFromDormancy();
+
 protected:
 	virtual void BeginPlay() override;
-	virtual void Tick(float DeltaTime) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void SetupPlayerInputComponent(class UInputComponent *PlayerInputComponent) override;
 	virtual void PossessedBy(AController *NewController) override;
 
@@ -113,8 +157,8 @@ protected:
 	/** Process area influences and update movement/behavior */
 	void ProcessAreaInfluences(float DeltaTime);
 
-	/** Decay fear naturally over time */
-	void DecayFear(float DeltaTime);
+	/** Fear lost to natural decay over DeltaTime; only reads state, so it is safe off the game thread */
+	float GetFearDecay(float DeltaTime) const;
 
 	// ===== Components =====
 
@@ -144,7 +188,7 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Cattle Animal|Abilities")
 	TArray<TSubclassOf<class UGameplayEffect>> DefaultEffects;
 
-	/** How often to update area influences (seconds) */
+	/** How often to check whether the animal changed tracking cell (seconds, scaled by significance); areas are only re-evaluated on a change */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Cattle Animal|Area")
 	float AreaUpdateInterval = 0.1f;
 
@@ -157,9 +201,6 @@ protected:
 	float LassoFearAmount = 50.0f;
 
 private:
-	/** Timer for area influence updates */
-	float AreaUpdateTimer = 0.0f;
-
 	/** Is currently lassoed */
 	bool bIsLassoed = false;
 
@@ -167,6 +208,36 @@ private:
 	UPROPERTY(Transient)
 	TObjectPtr<UCattleAreaSubsystem> CachedAreaSubsystem;
 
+	/** Cached tick subsystem reference; also buffers impulses */
+	UPROPERTY(Transient)
+	TObjectPtr<UCattleTickSubsystem> CachedTickSubsystem;
+
+	/** Cached fear field reference; tracks animals that spread panic */
+	UPROPERTY(Transient)
+	TObjectPtr<UCattleFearFieldSubsystem> CachedFearFieldSubsystem;
+
 	/** Current area influence */
 	FCattleAreaInfluence CurrentInfluence;
+
+	friend class UCattleHerdSubsystem;
+
+	/** Assigned by the herd subsystem on registration */
+	int32 HerdIndex = INDEX_NONE;
+
+	friend class UCattleSignificanceSubsystem;
+
+	/** Assigned by the significance subsystem on each evaluation that changes the tier */
+	int32 SignificanceTier = 0;
+	float SignificanceIntervalScale = 1.0f;
+
+	friend class UCattleTickSubsystem;
+
+	/** Assigned by the tick subsystem on registration; changes when another animal unregisters */
+	int32 TickIndex = INDEX_NONE;
+
+	friend class UCattleDormancySubsystem;
+
+	/** Maintained by the dormancy subsystem */
+	bool bIsDormant = false;
+	float DormancyIdleTime = 0.0f;
 };
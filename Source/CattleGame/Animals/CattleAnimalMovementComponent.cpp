@@ -1,11 +1,13 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "CattleAnimalMovementComponent.h"
+#include "CattleAnimal.h"
 #include "GameFramework/Character.h"
+#include "Components/SkeletalMeshComponent.h"
 
 UCattleAnimalMovementComponent::UCattleAnimalMovementComponent()
 {
-    // Enable tick for physics decay and influence processing
+    // Enable tick for influence processing
     PrimaryComponentTick.bCanEverTick = true;
 
     // Default movement settings for animals
@@ -20,39 +22,69 @@ UCattleAnimalMovementComponent::UCattleAnimalMovementComponent()
 
     // Disable controller rotation - let movement handle it
     bUseControllerDesiredRotation = false;
+
+    // Keep navmesh-walking animals on the rendered ground with an occasional trace
+    bProjectNavMeshWalking = true;
+    NavMeshProjectionInterval = 0.2f;
+
+    // Linear smoothing spans the whole gap between server updates, so animals simulated at a reduced rate still move smoothly on clients
+    NetworkSmoothingMode = ENetworkSmoothingMode::Linear;
 }
 
 void UCattleAnimalMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
-    // Decay physics velocity over time
-    DecayPhysicsVelocity(DeltaTime);
+    UpdateCalmMovement();
 
     // Add physics velocity to movement
     if (!PhysicsVelocity.IsNearlyZero())
     {
-        // Add physics velocity as additional velocity
+        // Integrate the decaying velocity over the whole step, so a shove moves an animal as far at a reduced simulation rate as at full rate
+        const float DecayedTime = PhysicsVelocityDecay > KINDA_SMALL_NUMBER
+                                      ? (1.0f - FMath::Exp(-PhysicsVelocityDecay * DeltaTime)) / PhysicsVelocityDecay
+                                      : DeltaTime;
+
         AddInputVector(PhysicsVelocity.GetSafeNormal(), true);
-        Velocity += PhysicsVelocity * DeltaTime;
+        Velocity += PhysicsVelocity * DecayedTime;
     }
 
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    // Decay over this component's own step rather than per frame
+    DecayPhysicsVelocity(DeltaTime);
+
+    if (ShouldInterpolateVisuals())
+    {
+        const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+        const FQuat OldRotation = UpdatedComponent->GetComponentQuat();
+
+        Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+        BeginVisualInterpolation(OldLocation, OldRotation);
+    }
+    else
+    {
+        Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    }
 }
 
 void UCattleAnimalMovementComponent::AddPhysicsImpulse(FVector Impulse, bool bVelocityChange)
 {
     if (bVelocityChange)
     {
-        // Directly set velocity (ignore mass)
-        PhysicsVelocity += Impulse * PhysicsInfluenceMultiplier;
+        AddPhysicsImpulses(Impulse, FVector::ZeroVector);
     }
     else
     {
-        // Apply impulse considering mass
-        float EffectiveMass = Mass > 0.0f ? Mass : 100.0f;
-        PhysicsVelocity += (Impulse / EffectiveMass) * PhysicsInfluenceMultiplier;
+        AddPhysicsImpulses(FVector::ZeroVector, Impulse);
     }
+}
+
+void UCattleAnimalMovementComponent::AddPhysicsImpulses(const FVector &VelocityChange, const FVector &Impulse)
+{
+    // Velocity changes ignore mass, impulses consider it
+    const float EffectiveMass = Mass > 0.0f ? Mass : 100.0f;
+    PhysicsVelocity += (VelocityChange + Impulse / EffectiveMass) * PhysicsInfluenceMultiplier;
 
     ClampPhysicsVelocity();
+    ExitCalmMovement();
 }
 
 void UCattleAnimalMovementComponent::AddPhysicsForce(FVector Force)
@@ -64,6 +96,7 @@ void UCattleAnimalMovementComponent::AddPhysicsForce(FVector Force)
     PhysicsVelocity += (Force / EffectiveMass) * PhysicsInfluenceMultiplier * GetWorld()->GetDeltaSeconds();
 
     ClampPhysicsVelocity();
+    ExitCalmMovement();
 }
 
 void UCattleAnimalMovementComponent::SetAreaInfluence(FVector Direction, float SpeedModifier)
@@ -96,6 +129,7 @@ void UCattleAnimalMovementComponent::SetMovementMode_Walking()
 void UCattleAnimalMovementComponent::SetMovementMode_Panic()
 {
     MaxWalkSpeed = PanicSpeed * AreaSpeedModifier;
+    ExitCalmMovement();
 }
 
 void UCattleAnimalMovementComponent::PhysicsVolumeChanged(APhysicsVolume *NewVolume)
@@ -104,6 +138,153 @@ void UCattleAnimalMovementComponent::PhysicsVolumeChanged(APhysicsVolume *NewVol
     // Could add water/special volume handling here
 }
 
+void UCattleAnimalMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode)
+{
+    Super::OnMovementModeChanged(PreviousMovementMode, PreviousCustomMode);
+
+    // The engine leaves navmesh walking by itself when no nav floor is found; don't retry straight away
+    if (PreviousMovementMode == MOVE_NavWalking && !bExitingCalmMovement)
+    {
+        CalmMovementBlockedUntil = GetWorld()->GetTimeSeconds() + CalmMovementRetryDelay;
+    }
+}
+
+bool UCattleAnimalMovementComponent::CanUseCalmMovement() const
+{
+    if (!bUseNavWalkingWhenCalm || !PhysicsVelocity.IsNearlyZero())
+    {
+        return false;
+    }
+
+    const ACattleAnimal *Animal = Cast<ACattleAnimal>(CharacterOwner);
+    return Animal && !Animal->IsLassoed() && !Animal->IsPanicked() && Animal->GetFearPercent() < CalmFearPercent;
+}
+
+void UCattleAnimalMovementComponent::UpdateCalmMovement()
+{
+    // Movement modes are decided by the server and replicated
+    if (!CharacterOwner || CharacterOwner->GetLocalRole() != ROLE_Authority)
+    {
+        return;
+    }
+
+    if (MovementMode == MOVE_NavWalking)
+    {
+        if (!CanUseCalmMovement())
+        {
+            ExitCalmMovement();
+        }
+    }
+    else if (MovementMode == MOVE_Walking && GetWorld()->GetTimeSeconds() >= CalmMovementBlockedUntil && CanUseCalmMovement())
+    {
+        SetMovementMode(MOVE_NavWalking);
+    }
+}
+
+void UCattleAnimalMovementComponent::ExitCalmMovement()
+{
+    if (MovementMode == MOVE_NavWalking)
+    {
+        TGuardValue<bool> ExitGuard(bExitingCalmMovement, true);
+        SetMovementMode(MOVE_Walking);
+    }
+}
+
+void UCattleAnimalMovementComponent::SetSimulationInterval(float Interval)
+{
+    // Simulated proxies need every frame for network smoothing
+    if (GetOwnerRole() != ROLE_Authority)
+    {
+        return;
+    }
+
+    SimulationInterval = FMath::Max(Interval, 0.0f);
+    SetComponentTickInterval(SimulationInterval);
+}
+
+bool UCattleAnimalMovementComponent::ShouldInterpolateVisuals() const
+{
+    return SimulationInterval > 0.0f && bInterpolateReducedRateVisuals && UpdatedComponent && CharacterOwner && GetNetMode() != NM_DedicatedServer;
+}
+
+void UCattleAnimalMovementComponent::BeginVisualInterpolation(const FVector &OldLocation, const FQuat &OldRotation)
+{
+    // Where the mesh was drawn before this step, including what remained of the previous offset
+    const float Remaining = bHasVisualOffset ? 1.0f - VisualInterpolationElapsed / VisualInterpolationDuration : 0.0f;
+    const FVector DrawnLocation = OldLocation + VisualLocationOffset * Remaining;
+    const FQuat DrawnRotation = FQuat::Slerp(FQuat::Identity, VisualRotationOffset, Remaining) * OldRotation;
+
+    const FVector NewLocation = UpdatedComponent->GetComponentLocation();
+    const FQuat NewRotation = UpdatedComponent->GetComponentQuat();
+
+    VisualLocationOffset = DrawnLocation - NewLocation;
+    VisualRotationOffset = DrawnRotation * NewRotation.Inverse();
+    VisualInterpolationDuration = SimulationInterval;
+    VisualInterpolationElapsed = 0.0f;
+    bHasVisualOffset = true;
+
+    // Teleports and large shoves snap
+    if (VisualLocationOffset.SizeSquared() > FMath::Square(MaxVisualInterpolationDistance))
+    {
+        VisualLocationOffset = FVector::ZeroVector;
+        VisualRotationOffset = FQuat::Identity;
+        bHasVisualOffset = false;
+    }
+
+    ApplyVisualOffset();
+}
+
+void UCattleAnimalMovementComponent::UpdateVisualInterpolation(float DeltaTime)
+{
+    if (!bHasVisualOffset)
+    {
+        return;
+    }
+
+    VisualInterpolationElapsed += DeltaTime;
+    if (VisualInterpolationElapsed >= VisualInterpolationDuration)
+    {
+        VisualLocationOffset = FVector::ZeroVector;
+        VisualRotationOffset = FQuat::Identity;
+        bHasVisualOffset = false;
+    }
+
+    ApplyVisualOffset();
+}
+
+void UCattleAnimalMovementComponent::ClearVisualOffset()
+{
+    if (!bHasVisualOffset)
+    {
+        return;
+    }
+
+    VisualLocationOffset = FVector::ZeroVector;
+    VisualRotationOffset = FQuat::Identity;
+    bHasVisualOffset = false;
+
+    ApplyVisualOffset();
+}
+
+void UCattleAnimalMovementComponent::ApplyVisualOffset()
+{
+    USkeletalMeshComponent *Mesh = CharacterOwner ? CharacterOwner->GetMesh() : nullptr;
+    if (!Mesh || !UpdatedComponent)
+    {
+        return;
+    }
+
+    const float Remaining = bHasVisualOffset ? 1.0f - VisualInterpolationElapsed / VisualInterpolationDuration : 0.0f;
+    const FQuat CapsuleRotation = UpdatedComponent->GetComponentQuat();
+    const FVector LocationOffset = VisualLocationOffset * Remaining;
+    const FQuat RotationOffset = FQuat::Slerp(FQuat::Identity, VisualRotationOffset, Remaining);
+
+    // The offsets are in world space; the mesh transform is relative to the capsule
+    Mesh->SetRelativeLocationAndRotation(
+        CharacterOwner->GetBaseTranslationOffset() + CapsuleRotation.UnrotateVector(LocationOffset),
+        CapsuleRotation.Inverse() * RotationOffset * CapsuleRotation * CharacterOwner->GetBaseRotationOffset());
+}
+
 void UCattleAnimalMovementComponent::DecayPhysicsVelocity(float DeltaTime)
 {
     if (!PhysicsVelocity.IsNearlyZero())
@@ -46,6 +46,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Cattle Movement")
     void AddPhysicsImpulse(FVector Impulse, bool bVelocityChange = false);
 
+    /** Apply summed impulses at once, clamping only the total (used to resolve buffered impulses) */
+    void AddPhysicsImpulses(const FVector &VelocityChange, const FVector &Impulse);
+
     /** Apply a continuous force to the animal's movement */
     UFUNCTION(BlueprintCallable, Category = "Cattle Movement")
     void AddPhysicsForce(FVector Force);
@@ -110,12 +113,79 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Cattle Movement")
     void SetMovementMode_Panic();
 
+    // ===== CALM MOVEMENT =====
+
+    /**
+     * Move calm animals in MOVE_NavWalking, which projects them onto the navmesh
+     * instead of sweeping the capsule and finding floors every tick. Animals go
+     * back to full walking when panicked, lassoed or pushed by an impulse.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cattle Movement|Calm")
+    bool bUseNavWalkingWhenCalm = true;
+
+    /** Fear (fraction of MaxFear) below which an animal counts as calm */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cattle Movement|Calm", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float CalmFearPercent = 0.3f;
+
+    /** Seconds before retrying navmesh walking after the engine dropped out of it (e.g. off the navmesh) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cattle Movement|Calm", meta = (ClampMin = "0.0"))
+    float CalmMovementRetryDelay = 2.0f;
+
+    /** Whether the animal is currently using the cheap navmesh walking mode */
+    UFUNCTION(BlueprintPure, Category = "Cattle Movement")
+    bool IsUsingCalmMovement() const { return MovementMode == MOVE_NavWalking; }
+
+    // ===== SIMULATION RATE =====
+
+    /** Interpolate the mesh between reduced-rate simulation steps (never on dedicated servers) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cattle Movement|Simulation Rate")
+    bool bInterpolateReducedRateVisuals = true;
+
+    /** Moves longer than this in one simulation step snap instead of interpolating */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cattle Movement|Simulation Rate", meta = (ClampMin = "0.0"))
+    float MaxVisualInterpolationDistance = 500.0f;
+
+    /**
+     * Simulate movement every Interval seconds instead of every frame (0 = every frame).
+     * Only applies with authority; simulated proxies keep ticking for network smoothing.
+     */
+    void SetSimulationInterval(float Interval);
+
+    /** Seconds between simulation steps (0 = every frame) */
+    float GetSimulationInterval() const { return SimulationInterval; }
+
+    /** Move the mesh toward the simulated transform; called every frame by UCattleTickSubsystem */
+    void UpdateVisualInterpolation(float DeltaTime);
+
+    /** Snap the mesh onto the capsule, dropping any remaining interpolation offset */
+    void ClearVisualOffset();
+
     // ===== OVERRIDES =====
 
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
     virtual void PhysicsVolumeChanged(APhysicsVolume *NewVolume) override;
 
 protected:
+    virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
+
+    /** Whether the owning animal may use navmesh walking right now */
+    bool CanUseCalmMovement() const;
+
+    /** Enter or leave navmesh walking to match CanUseCalmMovement */
+    void UpdateCalmMovement();
+
+    /** Switch back to full walking if navmesh walking is active */
+    void ExitCalmMovement();
+
+    /** Whether simulation steps should offset the mesh to hide the jump */
+    bool ShouldInterpolateVisuals() const;
+
+    /** Keep the mesh where it was drawn before a simulation step and start easing it onto the capsule */
+    void BeginVisualInterpolation(const FVector &OldLocation, const FQuat &OldRotation);
+
+    /** Place the mesh at its base offset plus the remaining interpolation offset */
+    void ApplyVisualOffset();
+
     /** Apply physics velocity decay */
     void DecayPhysicsVelocity(float DeltaTime);
 
@@ -124,4 +194,22 @@ protected:
 
     /** Clamp physics velocity to max */
     void ClampPhysicsVelocity();
+
+    /** World time before which navmesh walking is not re-entered */
+    double CalmMovementBlockedUntil = 0.0;
+
+    /** Set while we leave navmesh walking ourselves, so it is not treated as a fallback */
+    bool bExitingCalmMovement = false;
+
+    float SimulationInterval = 0.0f;
+
+    /** World-space mesh offset from the capsule right after the last simulation step */
+    FVector VisualLocationOffset = FVector::ZeroVector;
+    FQuat VisualRotationOffset = FQuat::Identity;
+
+    /** Time the offset takes to reach zero, and time spent so far */
+    float VisualInterpolationDuration = 0.0f;
+    float VisualInterpolationElapsed = 0.0f;
+
+    bool bHasVisualOffset = false;
 };
@@ -0,0 +1,275 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleDormancySubsystem.h"
+#include "CattleGame/Animals/CattleAnimal.h"
+#include "CattleGame/Animals/CattleAnimalMovementComponent.h"
+#include "CattleGame/Animals/AI/CattleAIController.h"
+#include "CattleGame/Animals/Areas/CattleAreaSubsystem.h"
+#include "CattleGame/Animals/Herd/CattleHerdSubsystem.h"
+#include "CattleGame/Animals/Perception/CattlePerceptionSubsystem.h"
+#include "CattleGame/Animals/Stimuli/CattleStimulusSubsystem.h"
+#include "CattleGame/Animals/Tick/CattleTickSubsystem.h"
+#include "AbilitySystemComponent.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+DECLARE_STATS_GROUP(TEXT("Cattle Dormancy"), STATGROUP_CattleDormancy, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("EvaluateDormancy"), STAT_CattleDormancy_Evaluate, STATGROUP_CattleDormancy);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Dormant Animals"), STAT_CattleDormancy_Dormant, STATGROUP_CattleDormancy);
+
+CSV_DEFINE_CATEGORY(CattleDormancy, true);
+
+static const TCHAR *DormancyPauseReason = TEXT("CattleDormancy");
+
+bool UCattleDormancySubsystem::ShouldCreateSubsystem(UObject *Outer) const
+{
+    if (UWorld *World = Cast<UWorld>(Outer))
+    {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+void UCattleDormancySubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // The AI only runs with authority
+    if (GetWorld()->GetNetMode() == NM_Client)
+    {
+        return;
+    }
+
+    TimeUntilEvaluation -= DeltaTime;
+    if (TimeUntilEvaluation <= 0.0f)
+    {
+        EvaluateDormancy(EvaluationInterval - TimeUntilEvaluation);
+        TimeUntilEvaluation = EvaluationInterval;
+    }
+
+    CSV_CUSTOM_STAT(CattleDormancy, DormantAnimals, NumDormantAnimals, ECsvCustomStatOp::Set);
+}
+
+TStatId UCattleDormancySubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCattleDormancySubsystem, STATGROUP_Tickables);
+}
+
+void UCattleDormancySubsystem::EvaluateDormancy(float ElapsedTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_CattleDormancy_Evaluate);
+
+    const UCattleHerdSubsystem *HerdSubsystem = GetWorld()->GetSubsystem<UCattleHerdSubsystem>();
+    if (!HerdSubsystem)
+    {
+        return;
+    }
+
+    UCattleAreaSubsystem *AreaSubsystem = GetWorld()->GetSubsystem<UCattleAreaSubsystem>();
+
+    TArray<FVector, TInlineAllocator<4>> PlayerLocations;
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        if (const APawn *Pawn = It->Get() ? It->Get()->GetPawn() : nullptr)
+        {
+            PlayerLocations.Add(Pawn->GetActorLocation());
+        }
+    }
+
+    NumDormantAnimals = 0;
+
+    for (int32 Index = 0; Index < HerdSubsystem->GetNumSlots(); ++Index)
+    {
+        ACattleAnimal *Animal = HerdSubsystem->GetAnimal(Index);
+        if (!Animal)
+        {
+            continue;
+        }
+
+        const FVector &Location = HerdSubsystem->GetAnimalLocation(Index);
+
+        if (Animal->bIsDormant)
+        {
+            // Entering or leaving an area wakes the animal from inside the refresh
+            if (AreaSubsystem)
+            {
+                AreaSubsystem->RefreshTrackedAnimal(Animal);
+            }
+
+            if (Animal->bIsDormant && (!bEnableDormancy || !IsUndisturbed(Animal, Location, PlayerLocations)))
+            {
+                WakeAnimal(Animal);
+            }
+
+            NumDormantAnimals += Animal->bIsDormant ? 1 : 0;
+            continue;
+        }
+
+        if (!bEnableDormancy || !IsGrazing(Animal) || !IsUndisturbed(Animal, Location, PlayerLocations))
+        {
+            Animal->DormancyIdleTime = 0.0f;
+            continue;
+        }
+
+        // Idle time keeps counting through grazing wanders; the animal only sleeps once it stands still
+        Animal->DormancyIdleTime += ElapsedTime;
+        if (Animal->DormancyIdleTime >= DormancyIdleTime && IsStandingStill(Animal))
+        {
+            PutToSleep(Animal);
+            ++NumDormantAnimals;
+        }
+    }
+
+    SET_DWORD_STAT(STAT_CattleDormancy_Dormant, NumDormantAnimals);
+}
+
+bool UCattleDormancySubsystem::IsUndisturbed(ACattleAnimal *Animal, const FVector &Location, TConstArrayView<FVector> PlayerLocations) const
+{
+    if (Animal->IsLassoed() || Animal->GetFearPercent() > MaxIdleFearPercent)
+    {
+        return false;
+    }
+
+    const UCattleAnimalMovementComponent *Movement = Animal->GetAnimalMovement();
+    if (Movement && !Movement->PhysicsVelocity.IsNearlyZero())
+    {
+        return false;
+    }
+
+    const double WakeDistanceSquared = FMath::Square(WakeDistance);
+    for (const FVector &PlayerLocation : PlayerLocations)
+    {
+        if (FVector::DistSquared(Location, PlayerLocation) < WakeDistanceSquared)
+        {
+            return false;
+        }
+    }
+
+    if (const UCattleStimulusSubsystem *StimulusSubsystem = GetWorld()->GetSubsystem<UCattleStimulusSubsystem>())
+    {
+        bool bStimulated = false;
+        StimulusSubsystem->ForEachStimulusAtLocation(Location, [&bStimulated](const FCattleStimulus &Stimulus, double DistanceSquared)
+                                                     { bStimulated = true; });
+        if (bStimulated)
+        {
+            return false;
+        }
+    }
+
+    if (const UCattlePerceptionSubsystem *PerceptionSubsystem = GetWorld()->GetSubsystem<UCattlePerceptionSubsystem>())
+    {
+        const FCattlePerception *Perception = PerceptionSubsystem->GetPerception(Animal);
+        if (Perception && (Perception->Threats.Num() > 0 || Perception->NearestExplosive.IsValid()))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool UCattleDormancySubsystem::IsGrazing(const ACattleAnimal *Animal)
+{
+    const FCattleAreaInfluence Influence = Animal->GetCurrentAreaInfluence();
+    return Influence.IsValid() && Influence.AreaType == ECattleAreaType::Graze;
+}
+
+bool UCattleDormancySubsystem::IsStandingStill(const ACattleAnimal *Animal)
+{
+    const UCattleAnimalMovementComponent *Movement = Animal->GetAnimalMovement();
+    if (!Movement || !Movement->IsMovingOnGround() || !Movement->Velocity.IsNearlyZero(1.0f))
+    {
+        return false;
+    }
+
+    const AAIController *Controller = Cast<AAIController>(Animal->GetController());
+    return !Controller || Controller->GetMoveStatus() == EPathFollowingStatus::Idle;
+}
+
+void UCattleDormancySubsystem::PutToSleep(ACattleAnimal *Animal)
+{
+    Animal->bIsDormant = true;
+
+    // The shared tick is what eases the mesh onto the capsule, so finish that now
+    if (UCattleAnimalMovementComponent *Movement = Animal->GetAnimalMovement())
+    {
+        Movement->ClearVisualOffset();
+    }
+
+    if (UCattleTickSubsystem *TickSubsystem = GetWorld()->GetSubsystem<UCattleTickSubsystem>())
+    {
+        TickSubsystem->UnregisterAnimal(Animal);
+    }
+
+    if (UCattleAnimalMovementComponent *Movement = Animal->GetAnimalMovement())
+    {
+        Movement->StopMovementImmediately();
+        Movement->SetComponentTickEnabled(false);
+    }
+
+    if (UAbilitySystemComponent *AbilitySystem = Animal->GetAbilitySystemComponent())
+    {
+        AbilitySystem->SetComponentTickEnabled(false);
+    }
+
+    if (ACattleAIController *Controller = Cast<ACattleAIController>(Animal->GetController()))
+    {
+        if (UBehaviorTreeComponent *BehaviorTree = Controller->GetBehaviorTreeComponent())
+        {
+            BehaviorTree->PauseLogic(DormancyPauseReason);
+            BehaviorTree->SetComponentTickEnabled(false);
+        }
+        if (UPathFollowingComponent *PathFollowing = Controller->GetPathFollowingComponent())
+        {
+            PathFollowing->SetComponentTickEnabled(false);
+        }
+        Controller->SetActorTickEnabled(false);
+    }
+
+    // Pending property changes still go out before the channel goes dormant
+    Animal->SetNetDormancy(DORM_DormantAll);
+}
+
+void UCattleDormancySubsystem::WakeAnimal(ACattleAnimal *Animal)
+{
+    if (!Animal || !Animal->bIsDormant)
+    {
+        return;
+    }
+
+    Animal->bIsDormant = false;
+    Animal->DormancyIdleTime = 0.0f;
+
+    Animal->SetNetDormancy(DORM_Awake);
+
+    if (ACattleAIController *Controller = Cast<ACattleAIController>(Animal->GetController()))
+    {
+        Controller->SetActorTickEnabled(true);
+        if (UPathFollowingComponent *PathFollowing = Controller->GetPathFollowingComponent())
+        {
+            PathFollowing->SetComponentTickEnabled(true);
+        }
+        if (UBehaviorTreeComponent *BehaviorTree = Controller->GetBehaviorTreeComponent())
+        {
+            BehaviorTree->SetComponentTickEnabled(true);
+            BehaviorTree->ResumeLogic(DormancyPauseReason);
+        }
+    }
+
+    if (UAbilitySystemComponent *AbilitySystem = Animal->GetAbilitySystemComponent())
+    {
+        AbilitySystem->SetComponentTickEnabled(true);
+    }
+
+    if (UCattleAnimalMovementComponent *Movement = Animal->GetAnimalMovement())
+    {
+        Movement->SetComponentTickEnabled(true);
+    }
+
+    if (UCattleTickSubsystem *TickSubsystem = GetWorld()->GetSubsystem<UCattleTickSubsystem>())
+    {
+        TickSubsystem->RegisterAnimal(Animal);
+    }
+}
@@ -0,0 +1,86 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CattleDormancySubsystem.generated.h"
+
+class ACattleAnimal;
+
+/**
+ * UCattleDormancySubsystem
+ *
+ * Puts idle grazing animals to sleep. An animal in a graze area that has been
+ * calm, unlassoed, free of physics velocity and out of reach of players,
+ * stimuli and threats for DormancyIdleTime, and is standing still, goes
+ * dormant: it leaves the shared cattle tick, its movement, ability system and
+ * behavior tree stop ticking, and it becomes network dormant.
+ *
+ * Dormant animals are woken by a periodic query (a player within WakeDistance,
+ * a stimulus reaching them or a perceived threat), by a change in the areas
+ * they are in, and immediately by fear, physics impulses and lasso capture
+ * through ACattleAnimal::WakeFromDormancy.
+ *
+ * Server only; dormancy is decided where the AI runs.
+ */
+UCLASS(Config = Game)
+class CATTLEGAME_API UCattleDormancySubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ===== Subsystem Lifecycle =====
+
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // ===== Dormancy =====
+
+    /** Wake a dormant animal; does nothing if it is awake */
+    void WakeAnimal(ACattleAnimal *Animal);
+
+    /** Number of dormant animals at the last evaluation */
+    int32 GetNumDormantAnimals() const { return NumDormantAnimals; }
+
+    // ===== Configuration =====
+
+    /** Whether idle animals go dormant */
+    UPROPERTY(Config)
+    bool bEnableDormancy = true;
+
+    /** Seconds an animal has to stay idle before it goes dormant */
+    UPROPERTY(Config)
+    float DormancyIdleTime = 10.0f;
+
+    /** Animals within this distance of a player never go dormant, and dormant ones wake */
+    UPROPERTY(Config)
+    float WakeDistance = 5000.0f;
+
+    /** Fear (fraction of MaxFear) above which an animal is not idle */
+    UPROPERTY(Config)
+    float MaxIdleFearPercent = 0.05f;
+
+    /** Seconds between idle and wake-up checks */
+    UPROPERTY(Config)
+    float EvaluationInterval = 0.5f;
+
+protected:
+    /** Advance idle timers, put idle animals to sleep and wake disturbed ones */
+    void EvaluateDormancy(float ElapsedTime);
+
+    /** Whether nothing around the animal calls for it to be awake */
+    bool IsUndisturbed(ACattleAnimal *Animal, const FVector &Location, TConstArrayView<FVector> PlayerLocations) const;
+
+    /** Whether the animal's primary area is a graze area; only grazing animals go dormant */
+    static bool IsGrazing(const ACattleAnimal *Animal);
+
+    /** Whether the animal is on the ground with no velocity and no move in progress */
+    static bool IsStandingStill(const ACattleAnimal *Animal);
+
+    void PutToSleep(ACattleAnimal *Animal);
+
+    int32 NumDormantAnimals = 0;
+    float TimeUntilEvaluation = 0.0f;
+};
@@ -0,0 +1,320 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleFearFieldSubsystem.h"
+#include "CattleGame/Animals/CattleAnimal.h"
+#include "CattleGame/Animals/Herd/CattleHerdSubsystem.h"
+#include "CattleGame/AbilitySystem/AnimalAttributeSet.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+DECLARE_STATS_GROUP(TEXT("Cattle Fear Field"), STATGROUP_CattleFearField, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("UpdateField"), STAT_CattleFearField_Update, STATGROUP_CattleFearField);
+DECLARE_CYCLE_STAT(TEXT("ApplyToAnimals"), STAT_CattleFearField_Apply, STATGROUP_CattleFearField);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Active Cells"), STAT_CattleFearField_ActiveCells, STATGROUP_CattleFearField);
+
+CSV_DEFINE_CATEGORY(CattleFearField, true);
+
+void UCattleFearFieldSubsystem::Deinitialize()
+{
+    Cells.Empty();
+    NextCells.Empty();
+    ContagionSourceAnimals.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UCattleFearFieldSubsystem::ShouldCreateSubsystem(UObject *Outer) const
+{
+    if (UWorld *World = Cast<UWorld>(Outer))
+    {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+void UCattleFearFieldSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // Fear attributes are server-authoritative
+    if (GetWorld()->GetNetMode() == NM_Client)
+    {
+        return;
+    }
+
+    ApplyToAnimals(DeltaTime);
+    UpdateField(DeltaTime);
+
+    SET_DWORD_STAT(STAT_CattleFearField_ActiveCells, Cells.Num());
+    CSV_CUSTOM_STAT(CattleFearField, ActiveCells, Cells.Num(), ECsvCustomStatOp::Set);
+}
+
+TStatId UCattleFearFieldSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCattleFearFieldSubsystem, STATGROUP_Tickables);
+}
+
+FIntPoint UCattleFearFieldSubsystem::GetCellAtLocation(const FVector &Location) const
+{
+    const float CellSize = FMath::Max(FearCellSize, 1.0f);
+    return FIntPoint(
+        FMath::FloorToInt32(Location.X / CellSize),
+        FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UCattleFearFieldSubsystem::AddFear(const FVector &Location, float Radius, float Amount)
+{
+    // Intensity that integrates to Amount over the decay of the field
+    Deposit(Location, Radius, Amount * FMath::Max(DecayRate, 0.1f), &FCattleFearCell::Fear);
+}
+
+void UCattleFearFieldSubsystem::OnFearAdded(ACattleAnimal *Animal)
+{
+    if (bEnableContagion && Animal && GetContagionIntensity(Animal->GetFearPercent()) > 0.0f)
+    {
+        ContagionSourceAnimals.Add(Animal);
+    }
+}
+
+float UCattleFearFieldSubsystem::SampleFear(const FVector &Location) const
+{
+    const FCattleFearCell *Cell = Cells.Find(GetCellAtLocation(Location));
+    return Cell ? Cell->Fear : 0.0f;
+}
+
+float UCattleFearFieldSubsystem::GetDepositedFear(const FVector &SourceLocation, float Radius, float Amount, const FVector &Location) const
+{
+    return Amount > 0.0f ? Amount * GetProximityFactor(SourceLocation, Radius, GetCellAtLocation(Location)) : 0.0f;
+}
+
+float UCattleFearFieldSubsystem::GetProximityFactor(const FVector &Location, float Radius, const FIntPoint &Cell) const
+{
+    // Matches the falloff Deposit uses: the source's own cell gets everything, other cells fall off to zero at Radius
+    const float CellSize = FMath::Max(FearCellSize, 1.0f);
+    if (Cell == GetCellAtLocation(Location))
+    {
+        return 1.0f;
+    }
+    if (Radius <= CellSize * 0.5f)
+    {
+        return 0.0f;
+    }
+
+    const FVector2D CellCenter((Cell.X + 0.5) * CellSize, (Cell.Y + 0.5) * CellSize);
+    return FMath::Max(1.0f - FVector2D::Distance(CellCenter, FVector2D(Location)) / Radius, 0.0f);
+}
+
+float UCattleFearFieldSubsystem::GetContagionIntensity(float FearPercent) const
+{
+    const float ContagionThreshold = FMath::Clamp(ContagionFearPercent, 0.0f, 0.99f);
+    if (FearPercent <= ContagionThreshold)
+    {
+        return 0.0f;
+    }
+
+    const float PanicFactor = (FearPercent - ContagionThreshold) / (1.0f - ContagionThreshold);
+    return ContagionFearPerSecond * PanicFactor;
+}
+
+void UCattleFearFieldSubsystem::Deposit(const FVector &Location, float Radius, float Intensity, float FCattleFearCell::*Channel)
+{
+    if (Intensity <= 0.0f)
+    {
+        return;
+    }
+
+    const float CellSize = FMath::Max(FearCellSize, 1.0f);
+
+    // Smaller than a cell; everything lands in the one cell
+    if (Radius <= CellSize * 0.5f)
+    {
+        Cells.FindOrAdd(GetCellAtLocation(Location)).*Channel += Intensity;
+        return;
+    }
+
+    const FIntPoint MinCell = GetCellAtLocation(Location - FVector(Radius, Radius, 0.0f));
+    const FIntPoint MaxCell = GetCellAtLocation(Location + FVector(Radius, Radius, 0.0f));
+
+    for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+    {
+        for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+        {
+            const float ProximityFactor = GetProximityFactor(Location, Radius, FIntPoint(X, Y));
+            if (ProximityFactor > 0.0f)
+            {
+                Cells.FindOrAdd(FIntPoint(X, Y)).*Channel += Intensity * ProximityFactor;
+            }
+        }
+    }
+}
+
+void UCattleFearFieldSubsystem::UpdateField(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_CattleFearField_Update);
+
+    if (Cells.Num() == 0)
+    {
+        return;
+    }
+
+    const float Keep = FMath::Exp(-FMath::Max(DecayRate, 0.0f) * DeltaTime);
+
+    // Explicit diffusion is only stable while a cell gives away less than it holds
+    const float Spread = FMath::Clamp(DiffusionRate * DeltaTime, 0.0f, 0.8f);
+
+    static const FIntPoint Neighbors[] = {FIntPoint(1, 0), FIntPoint(-1, 0), FIntPoint(0, 1), FIntPoint(0, -1)};
+
+    NextCells.Reset();
+
+    for (const TPair<FIntPoint, FCattleFearCell> &Pair : Cells)
+    {
+        const float Fear = Pair.Value.Fear * Keep;
+        const float Contagion = Pair.Value.Contagion * Keep;
+        const float FearShare = Fear * Spread * 0.25f;
+        const float ContagionShare = Contagion * Spread * 0.25f;
+
+        FCattleFearCell &Cell = NextCells.FindOrAdd(Pair.Key);
+
+        // Shares too small to survive the next update stay where they are
+        if (FMath::Max(FearShare, ContagionShare) < MinIntensity)
+        {
+            Cell.Fear += Fear;
+            Cell.Contagion += Contagion;
+            continue;
+        }
+
+        Cell.Fear += Fear - FearShare * 4.0f;
+        Cell.Contagion += Contagion - ContagionShare * 4.0f;
+
+        for (const FIntPoint &Offset : Neighbors)
+        {
+            const FIntPoint NeighborKey = Pair.Key + Offset;
+
+            // At capacity the field only spreads into cells it already covers
+            FCattleFearCell *Neighbor = NextCells.Find(NeighborKey);
+            if (!Neighbor && NextCells.Num() >= MaxActiveCells)
+            {
+                // Adding neighbors may have moved this cell's entry; look it up again
+                FCattleFearCell &Self = NextCells.FindChecked(Pair.Key);
+                Self.Fear += FearShare;
+                Self.Contagion += ContagionShare;
+                continue;
+            }
+
+            FCattleFearCell &Target = Neighbor ? *Neighbor : NextCells.Add(NeighborKey);
+            Target.Fear += FearShare;
+            Target.Contagion += ContagionShare;
+        }
+    }
+
+    for (auto It = NextCells.CreateIterator(); It; ++It)
+    {
+        if (It->Value.Fear < MinIntensity && It->Value.Contagion < MinIntensity)
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    Swap(Cells, NextCells);
+}
+
+void UCattleFearFieldSubsystem::ApplyToAnimals(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_CattleFearField_Apply);
+
+    if (!bEnableContagion)
+    {
+        ContagionSourceAnimals.Reset();
+    }
+
+    // Nothing to sample; only panicked animals can add to the field
+    if (Cells.Num() == 0)
+    {
+        ApplyContagionSources(DeltaTime);
+        return;
+    }
+
+    const UCattleHerdSubsystem *HerdSubsystem = GetWorld()->GetSubsystem<UCattleHerdSubsystem>();
+    if (!HerdSubsystem)
+    {
+        return;
+    }
+
+    struct FContagionSource
+    {
+        FVector Location;
+        float Intensity;
+    };
+    TArray<FContagionSource, TInlineAllocator<64>> ContagionSources;
+
+    // Rebuilt from the walk, which sees every animal
+    ContagionSourceAnimals.Reset();
+
+    const float ContagionThreshold = FMath::Clamp(ContagionFearPercent, 0.0f, 0.99f);
+
+    for (int32 Index = 0; Index < HerdSubsystem->GetNumSlots(); ++Index)
+    {
+        ACattleAnimal *Animal = HerdSubsystem->GetAnimal(Index);
+        if (!Animal)
+        {
+            continue;
+        }
+
+        const FVector &Location = HerdSubsystem->GetAnimalLocation(Index);
+        const float FearPercent = Animal->GetFearPercent();
+
+        if (const FCattleFearCell *Cell = Cells.Find(GetCellAtLocation(Location)))
+        {
+            float FearToAdd = Cell->Fear * DeltaTime;
+
+            // Contagion raises calmer animals up to the threshold but never beyond it
+            if (bEnableContagion && Cell->Contagion > 0.0f && FearPercent < ContagionThreshold)
+            {
+                if (const UAnimalAttributeSet *Attributes = Animal->GetAnimalAttributes())
+                {
+                    const float Headroom = (ContagionThreshold - FearPercent) * Attributes->GetMaxFear();
+                    FearToAdd += FMath::Min(Cell->Contagion * DeltaTime, Headroom);
+                }
+            }
+
+            Animal->AddFear(FearToAdd);
+        }
+
+        if (!bEnableContagion)
+        {
+            continue;
+        }
+
+        // Animals pushed over the threshold by this frame's field fear report themselves through AddFear
+        const float ContagionIntensity = GetContagionIntensity(FearPercent);
+        if (ContagionIntensity > 0.0f)
+        {
+            ContagionSources.Add({Location, ContagionIntensity});
+            ContagionSourceAnimals.Add(Animal);
+        }
+    }
+
+    // Deposited after sampling so animals do not feed their own cell this frame
+    for (const FContagionSource &Source : ContagionSources)
+    {
+        Deposit(Source.Location, ContagionRadius, Source.Intensity * FMath::Max(DecayRate, 0.1f) * DeltaTime, &FCattleFearCell::Contagion);
+    }
+}
+
+void UCattleFearFieldSubsystem::ApplyContagionSources(float DeltaTime)
+{
+    for (auto It = ContagionSourceAnimals.CreateIterator(); It; ++It)
+    {
+        const ACattleAnimal *Animal = It->Get();
+        const float ContagionIntensity = Animal ? GetContagionIntensity(Animal->GetFearPercent()) : 0.0f;
+
+        // Calmed down or gone; AddFear reports it again if it panics
+        if (ContagionIntensity <= 0.0f)
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+
+        Deposit(Animal->GetActorLocation(), ContagionRadius, ContagionIntensity * FMath::Max(DecayRate, 0.1f) * DeltaTime, &FCattleFearCell::Contagion);
+    }
+}
@@ -0,0 +1,147 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CattleFearFieldSubsystem.generated.h"
+
+class ACattleAnimal;
+
+/** Fear intensity stored in one field cell, in fear per second */
+struct FCattleFearCell
+{
+    /** Deposited by gameplay sources (gunshots, explosives, trumpet scares) */
+    float Fear = 0.0f;
+
+    /** Deposited by panicked animals; only raises animals up to ContagionFearPercent */
+    float Contagion = 0.0f;
+};
+
+/**
+ * UCattleFearFieldSubsystem
+ *
+ * Sparse XY grid that area-of-effect fear sources deposit into instead of
+ * overlapping for cattle and calling AddFear on each. Every frame the field
+ * diffuses to neighboring cells and decays, then each registered animal
+ * samples its cell once and gains that many fear per second.
+ *
+ * With contagion enabled, animals above ContagionFearPercent deposit into a
+ * separate channel that can push calmer neighbors up to, but not past, that
+ * threshold, so panic spreads through a herd but cannot sustain itself.
+ *
+ * While the field holds no fear only the animals above that threshold are
+ * visited; ACattleAnimal::AddFear reports animals that cross it.
+ *
+ * Server only. Single-target fear (direct hits, lasso capture, threat
+ * proximity) still goes through ACattleAnimal::AddFear.
+ */
+UCLASS(Config = Game)
+class CATTLEGAME_API UCattleFearFieldSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ===== Subsystem Lifecycle =====
+
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // ===== Sources =====
+
+    /**
+     * Deposit fear around a location, falling off linearly to zero at Radius.
+     * An animal standing at Location gains roughly Amount fear in total as the
+     * deposit decays. Continuous sources call this every frame with
+     * FearPerSecond * DeltaTime.
+     */
+    void AddFear(const FVector &Location, float Radius, float Amount);
+
+    /** Called when an animal gains fear; starts tracking it if it now spreads panic */
+    void OnFearAdded(ACattleAnimal *Animal);
+
+    // ===== Queries =====
+
+    /** Fear per second an animal at Location currently gains from sources */
+    float SampleFear(const FVector &Location) const;
+
+    /**
+     * Fear an AddFear(SourceLocation, Radius, Amount) deposit gives an animal
+     * at Location, before diffusion moves it. Lets a source that also targets
+     * an animal directly avoid counting the deposit twice.
+     */
+    float GetDepositedFear(const FVector &SourceLocation, float Radius, float Amount, const FVector &Location) const;
+
+    /** Number of cells holding any fear */
+    int32 GetNumActiveCells() const { return Cells.Num(); }
+
+    // ===== Configuration =====
+
+    /** Size of a field cell in world units */
+    UPROPERTY(Config)
+    float FearCellSize = 250.0f;
+
+    /** Fraction of a cell's fear spread to its four neighbors per second */
+    UPROPERTY(Config)
+    float DiffusionRate = 1.0f;
+
+    /** Exponential decay of the field per second */
+    UPROPERTY(Config)
+    float DecayRate = 2.0f;
+
+    /** Cells below this intensity are dropped */
+    UPROPERTY(Config)
+    float MinIntensity = 0.05f;
+
+    /** Diffusion stops growing the field beyond this many cells */
+    UPROPERTY(Config)
+    int32 MaxActiveCells = 16384;
+
+    /** Whether panicked animals spread fear to their neighbors */
+    UPROPERTY(Config)
+    bool bEnableContagion = true;
+
+    /** Fear (fraction of MaxFear) above which an animal spreads panic */
+    UPROPERTY(Config)
+    float ContagionFearPercent = 0.7f;
+
+    /** Radius of the fear a panicked animal spreads */
+    UPROPERTY(Config)
+    float ContagionRadius = 400.0f;
+
+    /** Fear per second a fully panicked animal spreads */
+    UPROPERTY(Config)
+    float ContagionFearPerSecond = 10.0f;
+
+protected:
+    /** Diffuse and decay every active cell */
+    void UpdateField(float DeltaTime);
+
+    /** Apply the field to every registered animal and collect contagion deposits */
+    void ApplyToAnimals(float DeltaTime);
+
+    /** Deposit contagion from the tracked panicked animals only; used while the field is empty */
+    void ApplyContagionSources(float DeltaTime);
+
+    /** Contagion deposit for an animal at FearPercent; zero below the threshold */
+    float GetContagionIntensity(float FearPercent) const;
+
+    /** Share of a deposit centered on Location that lands in Cell */
+    float GetProximityFactor(const FVector &Location, float Radius, const FIntPoint &Cell) const;
+
+    /** Add intensity to the cells within Radius of Location with linear falloff */
+    void Deposit(const FVector &Location, float Radius, float Intensity, float FCattleFearCell::*Channel);
+
+    /** Cell coordinate containing a world XY location */
+    FIntPoint GetCellAtLocation(const FVector &Location) const;
+
+    TMap<FIntPoint, FCattleFearCell> Cells;
+
+    /** Diffusion target, swapped with Cells every update */
+    TMap<FIntPoint, FCattleFearCell> NextCells;
+
+    /** Animals above ContagionFearPercent at the last walk, or reported since */
+    TSet<TWeakObjectPtr<ACattleAnimal>> ContagionSourceAnimals;
+};
@@ -0,0 +1,305 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleHerdProxySubsystem.h"
+#include "CattleHerdSubsystem.h"
+#include "CattleGame/Animals/CattleAnimal.h"
+#include "CattleGame/Animals/CattleAnimalMovementComponent.h"
+#include "CattleGame/Animals/Areas/CattleAreaSubsystem.h"
+#include "CattleGame/Animals/Mass/CattleMassSubsystem.h"
+#include "CattleGame/AbilitySystem/AnimalAttributeSet.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/PlayerController.h"
+
+void UCattleHerdProxySubsystem::Deinitialize()
+{
+    Proxies.Empty();
+    NumProxiedAnimals = 0;
+
+    Super::Deinitialize();
+}
+
+bool UCattleHerdProxySubsystem::ShouldCreateSubsystem(UObject *Outer) const
+{
+    if (UWorld *World = Cast<UWorld>(Outer))
+    {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+void UCattleHerdProxySubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // Animals are spawned and destroyed by the server only
+    if (!bEnableHerdProxies || GetWorld()->GetNetMode() == NM_Client)
+    {
+        return;
+    }
+
+    // The Mass backend takes over distant herds when enabled
+    const UCattleMassSubsystem *MassSubsystem = GetWorld()->GetSubsystem<UCattleMassSubsystem>();
+    if (MassSubsystem && MassSubsystem->IsMassEnabled())
+    {
+        return;
+    }
+
+    SimulateProxies(DeltaTime);
+
+    TimeUntilEvaluation -= DeltaTime;
+    if (TimeUntilEvaluation > 0.0f)
+    {
+        return;
+    }
+    TimeUntilEvaluation = EvaluationInterval;
+
+    TArray<FVector, TInlineAllocator<4>> PlayerLocations;
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        if (const APawn *Pawn = It->Get() ? It->Get()->GetPawn() : nullptr)
+        {
+            PlayerLocations.Add(Pawn->GetActorLocation());
+        }
+    }
+
+    // Without players there is nothing to measure distance against (e.g. before the first spawn)
+    if (PlayerLocations.Num() == 0)
+    {
+        return;
+    }
+
+    ExpandNearProxies(PlayerLocations);
+    CollapseDistantHerds(PlayerLocations);
+}
+
+TStatId UCattleHerdProxySubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCattleHerdProxySubsystem, STATGROUP_Tickables);
+}
+
+double UCattleHerdProxySubsystem::GetNearestPlayerDistanceSquared(const FVector &Location, TConstArrayView<FVector> PlayerLocations)
+{
+    double NearestDistanceSquared = TNumericLimits<double>::Max();
+    for (const FVector &PlayerLocation : PlayerLocations)
+    {
+        NearestDistanceSquared = FMath::Min(NearestDistanceSquared, FVector::DistSquaredXY(Location, PlayerLocation));
+    }
+    return NearestDistanceSquared;
+}
+
+void UCattleHerdProxySubsystem::SimulateProxies(float DeltaTime)
+{
+    const UCattleAreaSubsystem *AreaSubsystem = GetWorld()->GetSubsystem<UCattleAreaSubsystem>();
+
+    for (FCattleHerdProxy &Proxy : Proxies)
+    {
+        FCattleAreaInfluence Influence;
+        FVector FlowDirection = FVector::ZeroVector;
+        if (AreaSubsystem)
+        {
+            Influence = AreaSubsystem->GetPrimaryAreaAtLocation(Proxy.Centroid);
+            FlowDirection = AreaSubsystem->GetFlowDirectionAtLocation(Proxy.Centroid);
+        }
+
+        // Fear decays as it does on individual animals, twice as fast while grazing
+        if (Proxy.GetMeanFear() > 0.0f)
+        {
+            const float DecayRate = Influence.AreaType == ECattleAreaType::Graze ? Proxy.FearDecayRate * 2.0f : Proxy.FearDecayRate;
+            Proxy.DecayedFear += DecayRate * DeltaTime;
+        }
+
+        const bool bPanicked = Proxy.MaxFear > 0.0f && Proxy.GetMeanFear() / Proxy.MaxFear >= PanicFearPercent;
+
+        // Same blend as UCattleAnimalMovementComponent::CalculateInfluencedVelocity
+        float MaxSpeed = bPanicked ? Proxy.PanicSpeed : (Influence.AreaType == ECattleAreaType::Graze ? Proxy.GrazingSpeed : Proxy.WalkingSpeed);
+        FVector Direction = FVector::ZeroVector;
+        if (Influence.IsValid())
+        {
+            MaxSpeed *= FMath::Clamp(Influence.SpeedModifier, 0.1f, 3.0f);
+            Direction += Influence.InfluenceDirection.GetSafeNormal() * Proxy.AreaInfluenceStrength;
+        }
+        Direction += FlowDirection.GetSafeNormal() * Proxy.FlowInfluenceStrength;
+        Direction.Z = 0.0f;
+
+        Proxy.Velocity = Direction.GetSafeNormal() * MaxSpeed;
+        Proxy.Centroid += Proxy.Velocity * DeltaTime;
+
+        const float TargetSpread = bPanicked ? Proxy.BaseSpread * PanicSpreadScale : Proxy.BaseSpread;
+        Proxy.Spread = FMath::FInterpTo(Proxy.Spread, TargetSpread, DeltaTime, SpreadInterpSpeed);
+    }
+}
+
+void UCattleHerdProxySubsystem::ExpandNearProxies(TConstArrayView<FVector> PlayerLocations)
+{
+    const double ExpandDistanceSquared = FMath::Square(static_cast<double>(ExpandDistance));
+
+    for (int32 i = Proxies.Num() - 1; i >= 0; --i)
+    {
+        if (GetNearestPlayerDistanceSquared(Proxies[i].Centroid, PlayerLocations) < ExpandDistanceSquared)
+        {
+            ExpandProxy(Proxies[i]);
+            NumProxiedAnimals -= Proxies[i].Members.Num();
+            Proxies.RemoveAtSwap(i, EAllowShrinking::No);
+        }
+    }
+}
+
+void UCattleHerdProxySubsystem::ExpandProxy(const FCattleHerdProxy &Proxy)
+{
+    UWorld *World = GetWorld();
+    const float SpreadScale = Proxy.BaseSpread > 0.0f ? Proxy.Spread / Proxy.BaseSpread : 1.0f;
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    for (const FCattleHerdProxyMember &Member : Proxy.Members)
+    {
+        FVector Location = Proxy.Centroid + FVector(Member.Offset * Proxy.BaseSpread * SpreadScale, 0.0f);
+
+        // The centroid kept the herd's height at collapse; snap each animal to the ground under it
+        FHitResult GroundHit;
+        const FVector TraceOffset(0.0f, 0.0f, 5000.0f);
+        if (World->LineTraceSingleByChannel(GroundHit, Location + TraceOffset, Location - TraceOffset, ECC_Visibility))
+        {
+            Location = GroundHit.ImpactPoint;
+        }
+
+        if (const ACattleAnimal *DefaultAnimal = GetDefault<ACattleAnimal>(Member.AnimalClass))
+        {
+            if (const UCapsuleComponent *Capsule = DefaultAnimal->GetCapsuleComponent())
+            {
+                Location.Z += Capsule->GetScaledCapsuleHalfHeight();
+            }
+        }
+
+        ACattleAnimal *Animal = World->SpawnActor<ACattleAnimal>(Member.AnimalClass, Location, FRotator(0.0f, Member.Yaw, 0.0f), SpawnParams);
+        if (!Animal)
+        {
+            continue;
+        }
+
+        Animal->AddFear(Member.Fear - Proxy.DecayedFear);
+
+        if (UCattleAnimalMovementComponent *Movement = Animal->GetAnimalMovement())
+        {
+            Movement->Velocity = Proxy.Velocity;
+        }
+    }
+}
+
+void UCattleHerdProxySubsystem::CollapseDistantHerds(TConstArrayView<FVector> PlayerLocations)
+{
+    const UCattleHerdSubsystem *HerdSubsystem = GetWorld()->GetSubsystem<UCattleHerdSubsystem>();
+    if (!HerdSubsystem)
+    {
+        return;
+    }
+
+    const double CollapseDistanceSquared = FMath::Square(static_cast<double>(CollapseDistance));
+    const int32 NumSlots = HerdSubsystem->GetNumSlots();
+
+    // Slots far enough from every player to be collapsed, cleared as they are clustered
+    TBitArray<> Candidates(false, NumSlots);
+    for (int32 Index = 0; Index < NumSlots; ++Index)
+    {
+        const ACattleAnimal *Animal = HerdSubsystem->GetAnimal(Index);
+        if (Animal && !Animal->IsLassoed() && GetNearestPlayerDistanceSquared(HerdSubsystem->GetAnimalLocation(Index), PlayerLocations) >= CollapseDistanceSquared)
+        {
+            Candidates[Index] = true;
+        }
+    }
+
+    TArray<int32> Herd;
+    TArray<int32> Frontier;
+    TArray<int32, TInlineAllocator<32>> Neighbors;
+
+    for (int32 Seed = 0; Seed < NumSlots; ++Seed)
+    {
+        if (!Candidates[Seed])
+        {
+            continue;
+        }
+
+        // Flood-fill the herd through animals within ClusterRadius of each other
+        Herd.Reset();
+        Frontier.Reset();
+        Frontier.Add(Seed);
+        Candidates[Seed] = false;
+
+        while (Frontier.Num() > 0)
+        {
+            const int32 Index = Frontier.Pop(EAllowShrinking::No);
+            Herd.Add(Index);
+
+            HerdSubsystem->QueryRadius(HerdSubsystem->GetAnimalLocation(Index), ClusterRadius, Neighbors, Index);
+            for (const int32 Neighbor : Neighbors)
+            {
+                if (Candidates[Neighbor])
+                {
+                    Candidates[Neighbor] = false;
+                    Frontier.Add(Neighbor);
+                }
+            }
+        }
+
+        if (Herd.Num() < FMath::Max(MinProxyMembers, 1))
+        {
+            continue;
+        }
+
+        FCattleHerdProxy &Proxy = Proxies.AddDefaulted_GetRef();
+
+        for (const int32 Index : Herd)
+        {
+            Proxy.Centroid += HerdSubsystem->GetAnimalLocation(Index);
+            Proxy.Velocity += HerdSubsystem->GetAnimalVelocity(Index);
+        }
+        Proxy.Centroid /= Herd.Num();
+        Proxy.Velocity /= Herd.Num();
+
+        double SpreadSquaredSum = 0.0;
+        for (const int32 Index : Herd)
+        {
+            SpreadSquaredSum += FVector::DistSquaredXY(HerdSubsystem->GetAnimalLocation(Index), Proxy.Centroid);
+        }
+        Proxy.BaseSpread = FMath::Max(static_cast<float>(FMath::Sqrt(SpreadSquaredSum / Herd.Num())), 100.0f);
+        Proxy.Spread = Proxy.BaseSpread;
+
+        // Fear and movement tuning come from the first member; herds are usually one breed
+        const ACattleAnimal *FirstAnimal = HerdSubsystem->GetAnimal(Herd[0]);
+        if (const UAnimalAttributeSet *Attributes = FirstAnimal->GetAnimalAttributes())
+        {
+            Proxy.MaxFear = Attributes->GetMaxFear();
+            Proxy.FearDecayRate = Attributes->GetFearDecayRate();
+        }
+        if (const UCattleAnimalMovementComponent *Movement = FirstAnimal->GetAnimalMovement())
+        {
+            Proxy.GrazingSpeed = Movement->GrazingSpeed;
+            Proxy.WalkingSpeed = Movement->WalkingSpeed;
+            Proxy.PanicSpeed = Movement->PanicSpeed;
+            Proxy.AreaInfluenceStrength = Movement->AreaInfluenceStrength;
+            Proxy.FlowInfluenceStrength = Movement->FlowInfluenceStrength;
+        }
+
+        float FearSum = 0.0f;
+        Proxy.Members.Reserve(Herd.Num());
+
+        for (const int32 Index : Herd)
+        {
+            ACattleAnimal *Animal = HerdSubsystem->GetAnimal(Index);
+
+            FCattleHerdProxyMember &Member = Proxy.Members.AddDefaulted_GetRef();
+            Member.AnimalClass = Animal->GetClass();
+            Member.Offset = FVector2D(HerdSubsystem->GetAnimalLocation(Index) - Proxy.Centroid) / Proxy.BaseSpread;
+            Member.Yaw = Animal->GetActorRotation().Yaw;
+            Member.Fear = Animal->GetAnimalAttributes() ? Animal->GetAnimalAttributes()->GetFear() : 0.0f;
+            FearSum += Member.Fear;
+
+            // EndPlay unregisters it from the herd and area subsystems
+            Animal->Destroy();
+        }
+
+        Proxy.CollapsedMeanFear = FearSum / Herd.Num();
+        NumProxiedAnimals += Herd.Num();
+    }
+}
@@ -0,0 +1,158 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CattleHerdProxySubsystem.generated.h"
+
+class ACattleAnimal;
+
+/**
+ * One collapsed animal, stored relative to its proxy
+ */
+struct FCattleHerdProxyMember
+{
+    TSubclassOf<ACattleAnimal> AnimalClass;
+
+    /** XY offset from the centroid, in units of the proxy spread at collapse time */
+    FVector2D Offset = FVector2D::ZeroVector;
+
+    float Yaw = 0.0f;
+
+    /** Fear attribute value at collapse time */
+    float Fear = 0.0f;
+};
+
+/**
+ * FCattleHerdProxy
+ *
+ * A distant herd simulated as a single body: centroid motion, spread and
+ * mean fear. Individual animals are only restored on expansion.
+ */
+struct FCattleHerdProxy
+{
+    TArray<FCattleHerdProxyMember> Members;
+
+    FVector Centroid = FVector::ZeroVector;
+    FVector Velocity = FVector::ZeroVector;
+
+    /** Current RMS distance of members from the centroid */
+    float Spread = 0.0f;
+
+    /** Spread at collapse time; members are placed relative to it */
+    float BaseSpread = 0.0f;
+
+    /** Mean fear at collapse time, and fear decayed since */
+    float CollapsedMeanFear = 0.0f;
+    float DecayedFear = 0.0f;
+
+    // Fear and movement tuning copied from the first member at collapse
+    float MaxFear = 100.0f;
+    float FearDecayRate = 5.0f;
+    float GrazingSpeed = 100.0f;
+    float WalkingSpeed = 300.0f;
+    float PanicSpeed = 600.0f;
+    float AreaInfluenceStrength = 1.0f;
+    float FlowInfluenceStrength = 0.5f;
+
+    /** Approximate mean fear of the members */
+    float GetMeanFear() const { return FMath::Max(0.0f, CollapsedMeanFear - DecayedFear); }
+};
+
+/**
+ * UCattleHerdProxySubsystem
+ *
+ * Collapses herds that are far from every player into FCattleHerdProxy
+ * entries and destroys their animal actors. Proxies move with the same area
+ * and flow-field rules the movement component applies to individual animals,
+ * and fear decays the same way. When a player comes within ExpandDistance the
+ * animals are respawned around the proxy's centroid using the stored layout,
+ * so large maps hold many more logical cattle than live characters.
+ *
+ * Server only, and off unless bEnableHerdProxies is set in the Game config.
+ * Herds are found through UCattleHerdSubsystem. Inactive while
+ * UCattleMassSubsystem simulates distant animals instead.
+ */
+UCLASS(Config = Game)
+class CATTLEGAME_API UCattleHerdProxySubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ===== Subsystem Lifecycle =====
+
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // ===== Queries =====
+
+    /** Number of herd proxies */
+    int32 GetNumProxies() const { return Proxies.Num(); }
+
+    /** Number of animals currently represented by proxies instead of actors */
+    int32 GetNumProxiedAnimals() const { return NumProxiedAnimals; }
+
+    /** Proxies, for debugging and save systems */
+    const TArray<FCattleHerdProxy> &GetProxies() const { return Proxies; }
+
+    // ===== Configuration =====
+
+    /** Whether distant herds are collapsed at all */
+    UPROPERTY(Config)
+    bool bEnableHerdProxies = false;
+
+    /** Herds further than this from every player are collapsed */
+    UPROPERTY(Config)
+    float CollapseDistance = 20000.0f;
+
+    /** Proxies closer than this to any player are expanded; below CollapseDistance to avoid thrashing */
+    UPROPERTY(Config)
+    float ExpandDistance = 15000.0f;
+
+    /** Animals within this distance of each other belong to the same herd */
+    UPROPERTY(Config)
+    float ClusterRadius = 1500.0f;
+
+    /** Smallest herd worth collapsing */
+    UPROPERTY(Config)
+    int32 MinProxyMembers = 8;
+
+    /** Seconds between collapse/expand checks */
+    UPROPERTY(Config)
+    float EvaluationInterval = 1.0f;
+
+    /** Mean fear (fraction of MaxFear) at which a proxy moves at panic speed */
+    UPROPERTY(Config)
+    float PanicFearPercent = 0.7f;
+
+    /** Spread multiplier while panicked */
+    UPROPERTY(Config)
+    float PanicSpreadScale = 1.5f;
+
+    /** How quickly the spread moves toward its target (per second) */
+    UPROPERTY(Config)
+    float SpreadInterpSpeed = 0.5f;
+
+protected:
+    /** Move proxies and decay their fear */
+    void SimulateProxies(float DeltaTime);
+
+    /** Collapse far-away herds into proxies */
+    void CollapseDistantHerds(TConstArrayView<FVector> PlayerLocations);
+
+    /** Respawn the animals of proxies a player has come near */
+    void ExpandNearProxies(TConstArrayView<FVector> PlayerLocations);
+
+    /** Spawn a proxy's animals back into the world */
+    void ExpandProxy(const FCattleHerdProxy &Proxy);
+
+    /** Squared distance from a location to the nearest player (max float without players) */
+    static double GetNearestPlayerDistanceSquared(const FVector &Location, TConstArrayView<FVector> PlayerLocations);
+
+    TArray<FCattleHerdProxy> Proxies;
+    int32 NumProxiedAnimals = 0;
+    float TimeUntilEvaluation = 0.0f;
+};
@@ -0,0 +1,301 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleHerdSubsystem.h"
+#include "CattleGame/Animals/CattleAnimal.h"
+#include "Async/ParallelFor.h"
+
+void UCattleHerdSubsystem::Initialize(FSubsystemCollectionBase &Collection)
+{
+    Super::Initialize(Collection);
+
+    BuiltCellSize = FMath::Max(HerdCellSize, 1.0f);
+}
+
+void UCattleHerdSubsystem::Deinitialize()
+{
+    Animals.Empty();
+    Locations.Empty();
+    Velocities.Empty();
+    HerdDirections.Empty();
+    HerdCounts.Empty();
+    ActiveSlots.Empty();
+    FreeSlots.Empty();
+    SlotCells.Empty();
+    SortedSlots.Empty();
+    CellRanges.Empty();
+    NumActiveAnimals = 0;
+
+    Super::Deinitialize();
+}
+
+bool UCattleHerdSubsystem::ShouldCreateSubsystem(UObject *Outer) const
+{
+    if (UWorld *World = Cast<UWorld>(Outer))
+    {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+void UCattleHerdSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    RefreshSnapshot();
+    UpdateBoids();
+}
+
+TStatId UCattleHerdSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCattleHerdSubsystem, STATGROUP_Tickables);
+}
+
+void UCattleHerdSubsystem::RegisterAnimal(ACattleAnimal *Animal)
+{
+    if (!Animal || Animal->HerdIndex != INDEX_NONE)
+    {
+        return;
+    }
+
+    int32 Index;
+    if (FreeSlots.Num() > 0)
+    {
+        Index = FreeSlots.Pop(EAllowShrinking::No);
+    }
+    else
+    {
+        Index = Animals.AddDefaulted();
+        Locations.AddDefaulted();
+        Velocities.AddDefaulted();
+        HerdDirections.AddDefaulted();
+        HerdCounts.AddDefaulted();
+        SlotCells.AddDefaulted();
+        ActiveSlots.Add(false);
+    }
+
+    Animals[Index] = Animal;
+    Locations[Index] = Animal->GetActorLocation();
+    Velocities[Index] = Animal->GetVelocity();
+    HerdDirections[Index] = FVector::ZeroVector;
+    HerdCounts[Index] = 0;
+    ActiveSlots[Index] = true;
+    Animal->HerdIndex = Index;
+    ++NumActiveAnimals;
+}
+
+void UCattleHerdSubsystem::UnregisterAnimal(ACattleAnimal *Animal)
+{
+    if (!Animal || !Animals.IsValidIndex(Animal->HerdIndex) || Animals[Animal->HerdIndex].Get() != Animal)
+    {
+        return;
+    }
+
+    // The slot stays in the hash until the next snapshot; queries skip inactive slots
+    const int32 Index = Animal->HerdIndex;
+    Animals[Index].Reset();
+    ActiveSlots[Index] = false;
+    FreeSlots.Add(Index);
+    Animal->HerdIndex = INDEX_NONE;
+    --NumActiveAnimals;
+}
+
+ACattleAnimal *UCattleHerdSubsystem::GetAnimal(int32 Index) const
+{
+    return Animals.IsValidIndex(Index) ? Animals[Index].Get() : nullptr;
+}
+
+FIntPoint UCattleHerdSubsystem::GetCellAtLocation(const FVector &Location) const
+{
+    return FIntPoint(
+        FMath::FloorToInt32(Location.X / BuiltCellSize),
+        FMath::FloorToInt32(Location.Y / BuiltCellSize));
+}
+
+void UCattleHerdSubsystem::RefreshSnapshot()
+{
+    BuiltCellSize = FMath::Max(HerdCellSize, 1.0f);
+    SortedSlots.Reset();
+
+    for (int32 Index = 0; Index < ActiveSlots.Num(); ++Index)
+    {
+        if (!ActiveSlots[Index])
+        {
+            continue;
+        }
+
+        const ACattleAnimal *Animal = Animals[Index].Get();
+
+        // Destroyed without EndPlay (e.g. level streaming); free the slot here
+        if (!Animal)
+        {
+            ActiveSlots[Index] = false;
+            FreeSlots.Add(Index);
+            --NumActiveAnimals;
+            continue;
+        }
+
+        Locations[Index] = Animal->GetActorLocation();
+        Velocities[Index] = Animal->GetVelocity();
+        SlotCells[Index] = GetCellAtLocation(Locations[Index]);
+        SortedSlots.Add(Index);
+    }
+
+    SortedSlots.Sort([this](int32 A, int32 B)
+                     {
+        const FIntPoint &CellA = SlotCells[A];
+        const FIntPoint &CellB = SlotCells[B];
+        return CellA.Y != CellB.Y ? CellA.Y < CellB.Y : (CellA.X != CellB.X ? CellA.X < CellB.X : A < B); });
+
+    // Reset keeps the map's allocation, so a stable herd rebuilds without allocating
+    CellRanges.Reset();
+
+    for (int32 Start = 0; Start < SortedSlots.Num();)
+    {
+        const FIntPoint Cell = SlotCells[SortedSlots[Start]];
+
+        int32 End = Start + 1;
+        while (End < SortedSlots.Num() && SlotCells[SortedSlots[End]] == Cell)
+        {
+            ++End;
+        }
+
+        CellRanges.Add(Cell, FIntPoint(Start, End - Start));
+        Start = End;
+    }
+}
+
+void UCattleHerdSubsystem::UpdateBoids()
+{
+    QUICK_SCOPE_CYCLE_COUNTER(STAT_CattleHerd_UpdateBoids);
+
+    // Each task writes only its own slots and reads the snapshot, so no locking is needed
+    ParallelFor(
+        TEXT("CattleHerdBoids"), SortedSlots.Num(), FMath::Max(BoidsBatchSize, 1),
+        [this](int32 Entry)
+        { ComputeBoidSteering(SortedSlots[Entry]); });
+}
+
+void UCattleHerdSubsystem::ComputeBoidSteering(int32 Index)
+{
+    const FVector &MyLocation = Locations[Index];
+
+    TArray<int32, TInlineAllocator<32>> Neighbors;
+    if (MaxHerdMembers > 0)
+    {
+        QueryNearest(MyLocation, MaxHerdMembers, HerdRadius, Neighbors, Index);
+    }
+    else
+    {
+        QueryRadius(MyLocation, HerdRadius, Neighbors, Index);
+    }
+
+    const int32 HerdCount = Neighbors.Num();
+    HerdCounts[Index] = HerdCount;
+    HerdDirections[Index] = FVector::ZeroVector;
+
+    if (HerdCount == 0)
+    {
+        return;
+    }
+
+    FVector HerdCenter = FVector::ZeroVector;
+    FVector AverageVelocity = FVector::ZeroVector;
+    FVector SeparationForce = FVector::ZeroVector;
+
+    for (const int32 OtherIndex : Neighbors)
+    {
+        const FVector &OtherLocation = Locations[OtherIndex];
+        HerdCenter += OtherLocation;
+        AverageVelocity += Velocities[OtherIndex];
+
+        const float Distance = FVector::Dist(MyLocation, OtherLocation);
+        if (Distance < SeparationDistance && Distance > 0.0f)
+        {
+            FVector AwayDir = MyLocation - OtherLocation;
+            AwayDir.Z = 0.0f;
+            AwayDir.Normalize();
+            SeparationForce += AwayDir * (1.0f - Distance / SeparationDistance);
+        }
+    }
+
+    HerdCenter /= HerdCount;
+    AverageVelocity /= HerdCount;
+
+    FVector FinalDirection = FVector::ZeroVector;
+
+    // Cohesion - move toward herd center
+    FVector CohesionDir = HerdCenter - MyLocation;
+    CohesionDir.Z = 0.0f;
+    if (!CohesionDir.IsNearlyZero())
+    {
+        FinalDirection += CohesionDir.GetUnsafeNormal() * CohesionWeight;
+    }
+
+    // Alignment - match herd velocity direction
+    AverageVelocity.Z = 0.0f;
+    if (!AverageVelocity.IsNearlyZero())
+    {
+        FinalDirection += AverageVelocity.GetUnsafeNormal() * AlignmentWeight;
+    }
+
+    // Separation - avoid crowding
+    SeparationForce.Z = 0.0f;
+    if (!SeparationForce.IsNearlyZero())
+    {
+        FinalDirection += SeparationForce.GetUnsafeNormal() * SeparationWeight;
+    }
+
+    HerdDirections[Index] = FinalDirection.GetSafeNormal();
+}
+
+void UCattleHerdSubsystem::ForEachAnimalInRadius(const FVector &Center, float Radius, TFunctionRef<void(int32, double)> Func, int32 ExcludeIndex) const
+{
+    if (Radius <= 0.0f || CellRanges.Num() == 0)
+    {
+        return;
+    }
+
+    const double RadiusSquared = FMath::Square(static_cast<double>(Radius));
+    const FIntPoint MinCell = GetCellAtLocation(Center - FVector(Radius, Radius, 0.0f));
+    const FIntPoint MaxCell = GetCellAtLocation(Center + FVector(Radius, Radius, 0.0f));
+
+    auto VisitRange = [&](const FIntPoint &Range)
+    {
+        for (int32 Entry = Range.X; Entry < Range.X + Range.Y; ++Entry)
+        {
+            const int32 Index = SortedSlots[Entry];
+            if (Index == ExcludeIndex || !ActiveSlots[Index])
+            {
+                continue;
+            }
+
+            const double DistanceSquared = FVector::DistSquared(Center, Locations[Index]);
+            if (DistanceSquared <= RadiusSquared)
+            {
+                Func(Index, DistanceSquared);
+            }
+        }
+    };
+
+    const int64 NumCells = static_cast<int64>(MaxCell.X - MinCell.X + 1) * static_cast<int64>(MaxCell.Y - MinCell.Y + 1);
+    if (NumCells > CellRanges.Num())
+    {
+        // Query covers more cells than are occupied; scan the occupied ones instead
+        for (const TPair<FIntPoint, FIntPoint> &Pair : CellRanges)
+        {
+            VisitRange(Pair.Value);
+        }
+        return;
+    }
+
+    for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+    {
+        for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+        {
+            if (const FIntPoint *Range = CellRanges.Find(FIntPoint(X, Y)))
+            {
+                VisitRange(*Range);
+            }
+        }
+    }
+}
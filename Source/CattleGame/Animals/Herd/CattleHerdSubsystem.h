@@ -0,0 +1,185 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CattleHerdSubsystem.generated.h"
+
+class ACattleAnimal;
+
+/**
+ * UCattleHerdSubsystem
+ *
+ * World subsystem that keeps every live animal's position and velocity in flat
+ * arrays and buckets them into a uniform XY spatial hash once per frame, so herd
+ * queries only visit the cells around the query point instead of every animal.
+ *
+ * Animals are addressed by a stable slot index (ACattleAnimal::GetHerdIndex).
+ * Positions are snapshotted once per frame when the subsystem ticks; animals
+ * registered in between become visible to queries on the next snapshot.
+ *
+ * After each snapshot the boid steering (cohesion, alignment, separation) for
+ * every animal is computed in one parallel pass over the hash, and published
+ * per slot for the herd behavior service to read.
+ */
+UCLASS(Config = Game)
+class CATTLEGAME_API UCattleHerdSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ===== Subsystem Lifecycle =====
+
+    virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // ===== Registration =====
+
+    /** Add an animal to the herd index */
+    void RegisterAnimal(ACattleAnimal *Animal);
+
+    /** Remove an animal from the herd index */
+    void UnregisterAnimal(ACattleAnimal *Animal);
+
+    // ===== Queries =====
+
+    /** Call Func(Index, DistanceSquared) for every animal within Radius of Center, except ExcludeIndex */
+    void ForEachAnimalInRadius(const FVector &Center, float Radius, TFunctionRef<void(int32, double)> Func, int32 ExcludeIndex = INDEX_NONE) const;
+
+    /** Fill OutIndices with every animal within Radius of Center, in no particular order */
+    template <typename AllocatorType>
+    void QueryRadius(const FVector &Center, float Radius, TArray<int32, AllocatorType> &OutIndices, int32 ExcludeIndex = INDEX_NONE) const
+    {
+        OutIndices.Reset();
+        ForEachAnimalInRadius(Center, Radius, [&OutIndices](int32 Index, double DistanceSquared)
+                              { OutIndices.Add(Index); }, ExcludeIndex);
+    }
+
+    /** Fill OutIndices with up to Count animals within MaxRadius of Center, nearest first */
+    template <typename AllocatorType>
+    void QueryNearest(const FVector &Center, int32 Count, float MaxRadius, TArray<int32, AllocatorType> &OutIndices, int32 ExcludeIndex = INDEX_NONE) const
+    {
+        OutIndices.Reset();
+
+        TArray<TPair<double, int32>, TInlineAllocator<64>> Candidates;
+        ForEachAnimalInRadius(Center, MaxRadius, [&Candidates](int32 Index, double DistanceSquared)
+                              { Candidates.Emplace(DistanceSquared, Index); }, ExcludeIndex);
+
+        // Equal distances fall back to the slot index so results do not depend on hash order
+        Candidates.Sort([](const TPair<double, int32> &A, const TPair<double, int32> &B)
+                        { return A.Key != B.Key ? A.Key < B.Key : A.Value < B.Value; });
+
+        const int32 NumResults = FMath::Min(Count, Candidates.Num());
+        for (int32 i = 0; i < NumResults; ++i)
+        {
+            OutIndices.Add(Candidates[i].Value);
+        }
+    }
+
+    /** Animal in a slot, or nullptr */
+    ACattleAnimal *GetAnimal(int32 Index) const;
+
+    /** Location snapshotted this frame */
+    const FVector &GetAnimalLocation(int32 Index) const { return Locations[Index]; }
+
+    /** Velocity snapshotted this frame */
+    const FVector &GetAnimalVelocity(int32 Index) const { return Velocities[Index]; }
+
+    /** Number of registered animals */
+    int32 GetNumAnimals() const { return NumActiveAnimals; }
+
+    /** Upper bound on slot indices; freed slots return nullptr from GetAnimal */
+    int32 GetNumSlots() const { return Animals.Num(); }
+
+    // ===== Boids =====
+
+    /** Normalized boid steering direction computed this frame (zero when alone) */
+    const FVector &GetHerdDirection(int32 Index) const { return HerdDirections[Index]; }
+
+    /** Number of herd members that contributed to this frame's steering */
+    int32 GetHerdCount(int32 Index) const { return HerdCounts[Index]; }
+
+    // ===== Configuration =====
+
+    /** Size of a spatial hash cell in world units; about the typical herd query radius works best */
+    UPROPERTY(Config)
+    float HerdCellSize = 800.0f;
+
+    /** Radius to detect herd members */
+    UPROPERTY(Config)
+    float HerdRadius = 800.0f;
+
+    /** Only the nearest this many herd members within HerdRadius are considered (0 = all of them) */
+    UPROPERTY(Config)
+    int32 MaxHerdMembers = 0;
+
+    /** Minimum separation distance from other herd members */
+    UPROPERTY(Config)
+    float SeparationDistance = 150.0f;
+
+    /** Weight for cohesion (moving toward herd center) */
+    UPROPERTY(Config)
+    float CohesionWeight = 0.3f;
+
+    /** Weight for alignment (matching herd direction) */
+    UPROPERTY(Config)
+    float AlignmentWeight = 0.2f;
+
+    /** Weight for separation (avoiding crowding) */
+    UPROPERTY(Config)
+    float SeparationWeight = 0.5f;
+
+    /** Animals per parallel boids task; smaller herds run on the game thread */
+    UPROPERTY(Config)
+    int32 BoidsBatchSize = 64;
+
+protected:
+    // ===== Animal Data (indexed by slot) =====
+
+    TArray<TWeakObjectPtr<ACattleAnimal>> Animals;
+    TArray<FVector> Locations;
+    TArray<FVector> Velocities;
+
+    /** Whether a slot holds a registered animal */
+    TBitArray<> ActiveSlots;
+
+    /** Slots freed by unregistration, reused before the arrays grow */
+    TArray<int32> FreeSlots;
+
+    int32 NumActiveAnimals = 0;
+
+    // ===== Boid Results (indexed by slot) =====
+
+    TArray<FVector> HerdDirections;
+    TArray<int32> HerdCounts;
+
+    // ===== Spatial Hash =====
+
+    /** Cell each slot was hashed into at the last snapshot */
+    TArray<FIntPoint> SlotCells;
+
+    /** Active slots ordered by cell, so each cell's animals are contiguous */
+    TArray<int32> SortedSlots;
+
+    /** Cell coordinate -> (first entry in SortedSlots, entry count) */
+    TMap<FIntPoint, FIntPoint> CellRanges;
+
+    /** Cell size the hash was last built with */
+    float BuiltCellSize = 800.0f;
+
+    /** Cell coordinate containing a world XY location */
+    FIntPoint GetCellAtLocation(const FVector &Location) const;
+
+    /** Snapshot animal transforms and rebuild the spatial hash */
+    void RefreshSnapshot();
+
+    /** Compute the boid steering of every snapshotted animal in parallel */
+    void UpdateBoids();
+
+    /** Boid steering for one slot from the snapshot; reads shared state only */
+    void ComputeBoidSteering(int32 Index);
+};
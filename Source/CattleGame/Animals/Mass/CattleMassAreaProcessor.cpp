@@ -0,0 +1,71 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleMassAreaProcessor.h"
+#include "CattleMassFragments.h"
+#include "CattleMassSubsystem.h"
+#include "MassExecutionContext.h"
+
+UCattleMassAreaProcessor::UCattleMassAreaProcessor()
+    : EntityQuery(*this)
+{
+    // Run explicitly by UCattleMassSubsystem at its own rate
+    bAutoRegisterWithProcessingPhases = false;
+    bRequiresGameThreadExecution = true;
+}
+
+void UCattleMassAreaProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager)
+{
+    EntityQuery.AddRequirement<FCattleMassTransformFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddRequirement<FCattleMassAreaFragment>(EMassFragmentAccess::ReadWrite);
+}
+
+void UCattleMassAreaProcessor::Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context)
+{
+    const UCattleAreaSubsystem *AreaSubsystem = GetWorld()->GetSubsystem<UCattleAreaSubsystem>();
+    const UCattleMassSubsystem *MassSubsystem = GetWorld()->GetSubsystem<UCattleMassSubsystem>();
+    if (!AreaSubsystem || !MassSubsystem)
+    {
+        return;
+    }
+
+    const float SampleInterval = MassSubsystem->AreaSampleInterval;
+
+    EntityQuery.ForEachEntityChunk(Context, [this, AreaSubsystem, SampleInterval](FMassExecutionContext &Context)
+                                   {
+        const float DeltaTime = Context.GetDeltaTimeSeconds();
+        const TConstArrayView<FCattleMassTransformFragment> Transforms = Context.GetFragmentView<FCattleMassTransformFragment>();
+        const TArrayView<FCattleMassAreaFragment> Areas = Context.GetMutableFragmentView<FCattleMassAreaFragment>();
+
+        DueEntities.Reset();
+        DueLocations.Reset();
+
+        for (int32 EntityIndex = 0; EntityIndex < Context.GetNumEntities(); ++EntityIndex)
+        {
+            FCattleMassAreaFragment &Area = Areas[EntityIndex];
+            Area.TimeUntilSample -= DeltaTime;
+            if (Area.TimeUntilSample <= 0.0f)
+            {
+                Area.TimeUntilSample += SampleInterval;
+                DueEntities.Add(EntityIndex);
+                DueLocations.Add(Transforms[EntityIndex].Location);
+            }
+        }
+
+        if (DueEntities.Num() == 0)
+        {
+            return;
+        }
+
+        AreaSubsystem->GetPrimaryAreasAtLocations(DueLocations, Influences);
+
+        for (int32 i = 0; i < DueEntities.Num(); ++i)
+        {
+            const FCattleAreaInfluence &Influence = Influences[i];
+            FCattleMassAreaFragment &Area = Areas[DueEntities[i]];
+
+            Area.AreaType = Influence.IsValid() ? Influence.AreaType : ECattleAreaType::None;
+            Area.InfluenceDirection = Influence.IsValid() ? Influence.InfluenceDirection.GetSafeNormal() : FVector::ZeroVector;
+            Area.SpeedModifier = Influence.IsValid() ? FMath::Clamp(Influence.SpeedModifier, 0.1f, 3.0f) : 1.0f;
+            Area.FlowDirection = AreaSubsystem->GetFlowDirectionAtLocation(DueLocations[i]).GetSafeNormal();
+        } });
+}
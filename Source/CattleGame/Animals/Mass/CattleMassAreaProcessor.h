@@ -0,0 +1,37 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "CattleMassAreaProcessor.generated.h"
+
+/**
+ * UCattleMassAreaProcessor
+ *
+ * Samples area influence and flow direction for cattle entities, the Mass
+ * counterpart of ACattleAnimal::UpdateAreaInfluences. Entities due for a
+ * sample are batched per chunk through GetPrimaryAreasAtLocations.
+ *
+ * Runs on the game thread because the area subsystem is game-thread only.
+ */
+UCLASS()
+class CATTLEGAME_API UCattleMassAreaProcessor : public UMassProcessor
+{
+    GENERATED_BODY()
+
+public:
+    UCattleMassAreaProcessor();
+
+protected:
+    virtual void ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) override;
+    virtual void Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) override;
+
+    FMassEntityQuery EntityQuery;
+
+    // Reused between chunks
+    TArray<int32> DueEntities;
+    TArray<FVector> DueLocations;
+    TArray<FCattleAreaInfluence> Influences;
+};
@@ -0,0 +1,39 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleMassFearProcessor.h"
+#include "CattleMassFragments.h"
+#include "MassExecutionContext.h"
+
+UCattleMassFearProcessor::UCattleMassFearProcessor()
+    : EntityQuery(*this)
+{
+    // Run explicitly by UCattleMassSubsystem at its own rate
+    bAutoRegisterWithProcessingPhases = false;
+}
+
+void UCattleMassFearProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager)
+{
+    EntityQuery.AddRequirement<FCattleMassFearFragment>(EMassFragmentAccess::ReadWrite);
+    EntityQuery.AddRequirement<FCattleMassAreaFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddConstSharedRequirement<FCattleMassParamsFragment>();
+}
+
+void UCattleMassFearProcessor::Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context)
+{
+    EntityQuery.ForEachEntityChunk(Context, [](FMassExecutionContext &Context)
+                                   {
+        const float DeltaTime = Context.GetDeltaTimeSeconds();
+        const TArrayView<FCattleMassFearFragment> Fears = Context.GetMutableFragmentView<FCattleMassFearFragment>();
+        const TConstArrayView<FCattleMassAreaFragment> Areas = Context.GetFragmentView<FCattleMassAreaFragment>();
+        const FCattleMassParamsFragment &Params = Context.GetConstSharedFragment<FCattleMassParamsFragment>();
+
+        for (int32 EntityIndex = 0; EntityIndex < Context.GetNumEntities(); ++EntityIndex)
+        {
+            FCattleMassFearFragment &Fear = Fears[EntityIndex];
+            if (Fear.Fear > 0.0f)
+            {
+                const float DecayRate = Areas[EntityIndex].AreaType == ECattleAreaType::Graze ? Params.FearDecayRate * 2.0f : Params.FearDecayRate;
+                Fear.Fear = FMath::Max(0.0f, Fear.Fear - DecayRate * DeltaTime);
+            }
+        } });
+}
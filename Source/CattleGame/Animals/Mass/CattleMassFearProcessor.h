@@ -0,0 +1,29 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "CattleMassFearProcessor.generated.h"
+
+/**
+ * UCattleMassFearProcessor
+ *
+ * Decays cattle entity fear the way ACattleAnimal::ProcessInfluences does,
+ * twice as fast while grazing.
+ */
+UCLASS()
+class CATTLEGAME_API UCattleMassFearProcessor : public UMassProcessor
+{
+    GENERATED_BODY()
+
+public:
+    UCattleMassFearProcessor();
+
+protected:
+    virtual void ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) override;
+    virtual void Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) override;
+
+    FMassEntityQuery EntityQuery;
+};
@@ -0,0 +1,102 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "CattleGame/Animals/Areas/CattleAreaSubsystem.h"
+#include "CattleMassFragments.generated.h"
+
+class ACattleAnimal;
+
+/**
+ * Location and facing of a cattle entity. Height is kept from demotion;
+ * animals are snapped to the ground when promoted back to actors.
+ */
+USTRUCT()
+struct CATTLEGAME_API FCattleMassTransformFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+    FVector Location = FVector::ZeroVector;
+    float Yaw = 0.0f;
+};
+
+USTRUCT()
+struct CATTLEGAME_API FCattleMassVelocityFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+    FVector Velocity = FVector::ZeroVector;
+};
+
+USTRUCT()
+struct CATTLEGAME_API FCattleMassFearFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+    float Fear = 0.0f;
+};
+
+/** Area and flow influence, resampled every AreaSampleInterval */
+USTRUCT()
+struct CATTLEGAME_API FCattleMassAreaFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+    ECattleAreaType AreaType = ECattleAreaType::None;
+    FVector InfluenceDirection = FVector::ZeroVector;
+    float SpeedModifier = 1.0f;
+    FVector FlowDirection = FVector::ZeroVector;
+
+    /** Seconds until the next sample; staggered so sampling cost is spread over frames */
+    float TimeUntilSample = 0.0f;
+};
+
+/** Boid steering from neighboring entities, same rules as UCattleHerdSubsystem */
+USTRUCT()
+struct CATTLEGAME_API FCattleMassHerdFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+    /** Normalized steering direction (zero when alone) */
+    FVector HerdDirection = FVector::ZeroVector;
+
+    /** Neighbors that contributed to the steering */
+    int32 HerdCount = 0;
+};
+
+/**
+ * Per-breed tuning copied from the animal class, shared by every entity of
+ * that class.
+ */
+USTRUCT()
+struct CATTLEGAME_API FCattleMassParamsFragment : public FMassConstSharedFragment
+{
+    GENERATED_BODY()
+
+    /** Class spawned when the entity is promoted back to an actor */
+    UPROPERTY()
+    TSubclassOf<ACattleAnimal> AnimalClass;
+
+    UPROPERTY()
+    float MaxFear = 100.0f;
+
+    UPROPERTY()
+    float FearDecayRate = 5.0f;
+
+    UPROPERTY()
+    float GrazingSpeed = 100.0f;
+
+    UPROPERTY()
+    float WalkingSpeed = 300.0f;
+
+    UPROPERTY()
+    float PanicSpeed = 600.0f;
+
+    UPROPERTY()
+    float AreaInfluenceStrength = 1.0f;
+
+    UPROPERTY()
+    float FlowInfluenceStrength = 0.5f;
+};
@@ -0,0 +1,196 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleMassHerdProcessor.h"
+#include "CattleMassFragments.h"
+#include "CattleGame/Animals/Herd/CattleHerdSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "MassExecutionContext.h"
+
+UCattleMassHerdProcessor::UCattleMassHerdProcessor()
+    : EntityQuery(*this)
+{
+    // Run explicitly by UCattleMassSubsystem at its own rate
+    bAutoRegisterWithProcessingPhases = false;
+}
+
+void UCattleMassHerdProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager)
+{
+    EntityQuery.AddRequirement<FCattleMassTransformFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddRequirement<FCattleMassVelocityFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddRequirement<FCattleMassHerdFragment>(EMassFragmentAccess::ReadWrite);
+}
+
+FIntPoint UCattleMassHerdProcessor::GetCellAtLocation(const FVector &Location) const
+{
+    return FIntPoint(
+        FMath::FloorToInt32(Location.X / CellSize),
+        FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UCattleMassHerdProcessor::Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context)
+{
+    // Herd tuning is shared with live animals
+    const UCattleHerdSubsystem *HerdSubsystem = GetWorld()->GetSubsystem<UCattleHerdSubsystem>();
+    const UCattleHerdSubsystem &Settings = HerdSubsystem ? *HerdSubsystem : *GetDefault<UCattleHerdSubsystem>();
+
+    CellSize = FMath::Max(Settings.HerdCellSize, 1.0f);
+    Locations.Reset();
+    Velocities.Reset();
+    Cells.Reset();
+
+    // Gather; the write pass below visits the chunks in the same order
+    EntityQuery.ForEachEntityChunk(Context, [this](FMassExecutionContext &Context)
+                                   {
+        const TConstArrayView<FCattleMassTransformFragment> Transforms = Context.GetFragmentView<FCattleMassTransformFragment>();
+        const TConstArrayView<FCattleMassVelocityFragment> EntityVelocities = Context.GetFragmentView<FCattleMassVelocityFragment>();
+
+        for (int32 EntityIndex = 0; EntityIndex < Context.GetNumEntities(); ++EntityIndex)
+        {
+            Locations.Add(Transforms[EntityIndex].Location);
+            Velocities.Add(EntityVelocities[EntityIndex].Velocity);
+            Cells.Add(GetCellAtLocation(Transforms[EntityIndex].Location));
+        } });
+
+    const int32 NumEntities = Locations.Num();
+    HerdDirections.SetNumUninitialized(NumEntities);
+    HerdCounts.SetNumUninitialized(NumEntities);
+
+    SortedEntries.Reset(NumEntities);
+    for (int32 Index = 0; Index < NumEntities; ++Index)
+    {
+        SortedEntries.Add(Index);
+    }
+
+    SortedEntries.Sort([this](int32 A, int32 B)
+                       {
+        const FIntPoint &CellA = Cells[A];
+        const FIntPoint &CellB = Cells[B];
+        return CellA.Y != CellB.Y ? CellA.Y < CellB.Y : (CellA.X != CellB.X ? CellA.X < CellB.X : A < B); });
+
+    CellRanges.Reset();
+    for (int32 Start = 0; Start < SortedEntries.Num();)
+    {
+        const FIntPoint Cell = Cells[SortedEntries[Start]];
+
+        int32 End = Start + 1;
+        while (End < SortedEntries.Num() && Cells[SortedEntries[End]] == Cell)
+        {
+            ++End;
+        }
+
+        CellRanges.Add(Cell, FIntPoint(Start, End - Start));
+        Start = End;
+    }
+
+    // Each task writes only its own entries and reads the snapshot, so no locking is needed
+    ParallelFor(
+        TEXT("CattleMassHerd"), SortedEntries.Num(), FMath::Max(Settings.BoidsBatchSize, 1),
+        [this, &Settings](int32 Entry)
+        { ComputeBoidSteering(SortedEntries[Entry], Settings); });
+
+    int32 NextIndex = 0;
+    EntityQuery.ForEachEntityChunk(Context, [this, &NextIndex](FMassExecutionContext &Context)
+                                   {
+        const TArrayView<FCattleMassHerdFragment> Herds = Context.GetMutableFragmentView<FCattleMassHerdFragment>();
+
+        for (int32 EntityIndex = 0; EntityIndex < Context.GetNumEntities(); ++EntityIndex, ++NextIndex)
+        {
+            Herds[EntityIndex].HerdDirection = HerdDirections[NextIndex];
+            Herds[EntityIndex].HerdCount = HerdCounts[NextIndex];
+        } });
+}
+
+void UCattleMassHerdProcessor::ComputeBoidSteering(int32 Index, const UCattleHerdSubsystem &Settings)
+{
+    const FVector &MyLocation = Locations[Index];
+    const float Radius = Settings.HerdRadius;
+    const double RadiusSquared = FMath::Square(static_cast<double>(Radius));
+
+    TArray<TPair<double, int32>, TInlineAllocator<64>> Neighbors;
+
+    const FIntPoint MinCell = GetCellAtLocation(MyLocation - FVector(Radius, Radius, 0.0f));
+    const FIntPoint MaxCell = GetCellAtLocation(MyLocation + FVector(Radius, Radius, 0.0f));
+    for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+    {
+        for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+        {
+            const FIntPoint *Range = CellRanges.Find(FIntPoint(X, Y));
+            if (!Range)
+            {
+                continue;
+            }
+
+            for (int32 Entry = Range->X; Entry < Range->X + Range->Y; ++Entry)
+            {
+                const int32 OtherIndex = SortedEntries[Entry];
+                const double DistanceSquared = FVector::DistSquared(MyLocation, Locations[OtherIndex]);
+                if (OtherIndex != Index && DistanceSquared <= RadiusSquared)
+                {
+                    Neighbors.Emplace(DistanceSquared, OtherIndex);
+                }
+            }
+        }
+    }
+
+    if (Settings.MaxHerdMembers > 0 && Neighbors.Num() > Settings.MaxHerdMembers)
+    {
+        Neighbors.Sort([](const TPair<double, int32> &A, const TPair<double, int32> &B)
+                       { return A.Key != B.Key ? A.Key < B.Key : A.Value < B.Value; });
+        Neighbors.SetNum(Settings.MaxHerdMembers, EAllowShrinking::No);
+    }
+
+    const int32 HerdCount = Neighbors.Num();
+    HerdCounts[Index] = HerdCount;
+    HerdDirections[Index] = FVector::ZeroVector;
+
+    if (HerdCount == 0)
+    {
+        return;
+    }
+
+    FVector HerdCenter = FVector::ZeroVector;
+    FVector AverageVelocity = FVector::ZeroVector;
+    FVector SeparationForce = FVector::ZeroVector;
+
+    for (const TPair<double, int32> &Neighbor : Neighbors)
+    {
+        const FVector &OtherLocation = Locations[Neighbor.Value];
+        HerdCenter += OtherLocation;
+        AverageVelocity += Velocities[Neighbor.Value];
+
+        const float Distance = FMath::Sqrt(Neighbor.Key);
+        if (Distance < Settings.SeparationDistance && Distance > 0.0f)
+        {
+            FVector AwayDir = MyLocation - OtherLocation;
+            AwayDir.Z = 0.0f;
+            AwayDir.Normalize();
+            SeparationForce += AwayDir * (1.0f - Distance / Settings.SeparationDistance);
+        }
+    }
+
+    HerdCenter /= HerdCount;
+    AverageVelocity /= HerdCount;
+
+    FVector FinalDirection = FVector::ZeroVector;
+
+    FVector CohesionDir = HerdCenter - MyLocation;
+    CohesionDir.Z = 0.0f;
+    if (!CohesionDir.IsNearlyZero())
+    {
+        FinalDirection += CohesionDir.GetUnsafeNormal() * Settings.CohesionWeight;
+    }
+
+    AverageVelocity.Z = 0.0f;
+    if (!AverageVelocity.IsNearlyZero())
+    {
+        FinalDirection += AverageVelocity.GetUnsafeNormal() * Settings.AlignmentWeight;
+    }
+
+    SeparationForce.Z = 0.0f;
+    if (!SeparationForce.IsNearlyZero())
+    {
+        FinalDirection += SeparationForce.GetUnsafeNormal() * Settings.SeparationWeight;
+    }
+
+    HerdDirections[Index] = FinalDirection.GetSafeNormal();
+}
@@ -0,0 +1,58 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "CattleMassHerdProcessor.generated.h"
+
+class UCattleHerdSubsystem;
+
+/**
+ * UCattleMassHerdProcessor
+ *
+ * Boid steering (cohesion, alignment, separation) for cattle entities, with
+ * the tuning and rules of UCattleHerdSubsystem. Entity positions are gathered
+ * into a cell-sorted spatial hash, steering is computed in a parallel pass
+ * over it, and the results are written back to FCattleMassHerdFragment.
+ *
+ * Entities only herd with other entities; actors are handled by the herd
+ * subsystem.
+ */
+UCLASS()
+class CATTLEGAME_API UCattleMassHerdProcessor : public UMassProcessor
+{
+    GENERATED_BODY()
+
+public:
+    UCattleMassHerdProcessor();
+
+protected:
+    virtual void ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) override;
+    virtual void Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) override;
+
+    /** Cell coordinate containing a world XY location */
+    FIntPoint GetCellAtLocation(const FVector &Location) const;
+
+    /** Boid steering for one gathered entity; reads the snapshot only */
+    void ComputeBoidSteering(int32 Index, const UCattleHerdSubsystem &Settings);
+
+    FMassEntityQuery EntityQuery;
+
+    // ===== Snapshot (indexed in query order) =====
+
+    TArray<FVector> Locations;
+    TArray<FVector> Velocities;
+    TArray<FIntPoint> Cells;
+    TArray<FVector> HerdDirections;
+    TArray<int32> HerdCounts;
+
+    /** Snapshot indices ordered by cell */
+    TArray<int32> SortedEntries;
+
+    /** Cell coordinate -> (first entry in SortedEntries, entry count) */
+    TMap<FIntPoint, FIntPoint> CellRanges;
+
+    float CellSize = 800.0f;
+};
@@ -0,0 +1,72 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleMassMovementProcessor.h"
+#include "CattleMassFragments.h"
+#include "CattleMassSubsystem.h"
+#include "MassExecutionContext.h"
+
+UCattleMassMovementProcessor::UCattleMassMovementProcessor()
+    : EntityQuery(*this)
+{
+    // Run explicitly by UCattleMassSubsystem at its own rate
+    bAutoRegisterWithProcessingPhases = false;
+}
+
+void UCattleMassMovementProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager)
+{
+    EntityQuery.AddRequirement<FCattleMassTransformFragment>(EMassFragmentAccess::ReadWrite);
+    EntityQuery.AddRequirement<FCattleMassVelocityFragment>(EMassFragmentAccess::ReadWrite);
+    EntityQuery.AddRequirement<FCattleMassFearFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddRequirement<FCattleMassAreaFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddRequirement<FCattleMassHerdFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddConstSharedRequirement<FCattleMassParamsFragment>();
+}
+
+void UCattleMassMovementProcessor::Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context)
+{
+    const UCattleMassSubsystem *MassSubsystem = GetWorld()->GetSubsystem<UCattleMassSubsystem>();
+    if (!MassSubsystem)
+    {
+        return;
+    }
+
+    const float PanicFearPercent = MassSubsystem->PanicFearPercent;
+    const float HerdInfluenceStrength = MassSubsystem->HerdInfluenceStrength;
+
+    EntityQuery.ForEachEntityChunk(Context, [PanicFearPercent, HerdInfluenceStrength](FMassExecutionContext &Context)
+                                   {
+        const float DeltaTime = Context.GetDeltaTimeSeconds();
+        const TArrayView<FCattleMassTransformFragment> Transforms = Context.GetMutableFragmentView<FCattleMassTransformFragment>();
+        const TArrayView<FCattleMassVelocityFragment> Velocities = Context.GetMutableFragmentView<FCattleMassVelocityFragment>();
+        const TConstArrayView<FCattleMassFearFragment> Fears = Context.GetFragmentView<FCattleMassFearFragment>();
+        const TConstArrayView<FCattleMassAreaFragment> Areas = Context.GetFragmentView<FCattleMassAreaFragment>();
+        const TConstArrayView<FCattleMassHerdFragment> Herds = Context.GetFragmentView<FCattleMassHerdFragment>();
+        const FCattleMassParamsFragment &Params = Context.GetConstSharedFragment<FCattleMassParamsFragment>();
+
+        for (int32 EntityIndex = 0; EntityIndex < Context.GetNumEntities(); ++EntityIndex)
+        {
+            const FCattleMassAreaFragment &Area = Areas[EntityIndex];
+            const bool bPanicked = Params.MaxFear > 0.0f && Fears[EntityIndex].Fear / Params.MaxFear >= PanicFearPercent;
+
+            // Same blend as UCattleAnimalMovementComponent::CalculateInfluencedVelocity, plus herding
+            float MaxSpeed = bPanicked ? Params.PanicSpeed : (Area.AreaType == ECattleAreaType::Graze ? Params.GrazingSpeed : Params.WalkingSpeed);
+            FVector Direction = Herds[EntityIndex].HerdDirection * HerdInfluenceStrength;
+            if (Area.AreaType != ECattleAreaType::None)
+            {
+                MaxSpeed *= Area.SpeedModifier;
+                Direction += Area.InfluenceDirection * Params.AreaInfluenceStrength;
+            }
+            Direction += Area.FlowDirection * Params.FlowInfluenceStrength;
+            Direction.Z = 0.0f;
+
+            FVector &Velocity = Velocities[EntityIndex].Velocity;
+            Velocity = Direction.GetSafeNormal() * MaxSpeed;
+
+            FCattleMassTransformFragment &Transform = Transforms[EntityIndex];
+            Transform.Location += Velocity * DeltaTime;
+            if (!Velocity.IsNearlyZero())
+            {
+                Transform.Yaw = Velocity.Rotation().Yaw;
+            }
+        } });
+}
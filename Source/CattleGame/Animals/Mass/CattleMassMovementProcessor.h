@@ -0,0 +1,31 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "CattleMassMovementProcessor.generated.h"
+
+/**
+ * UCattleMassMovementProcessor
+ *
+ * Moves cattle entities with the area/flow blend of
+ * UCattleAnimalMovementComponent plus the herd steering, at grazing, walking
+ * or panic speed depending on area and fear. Movement is planar; there is no
+ * collision or navmesh for entities.
+ */
+UCLASS()
+class CATTLEGAME_API UCattleMassMovementProcessor : public UMassProcessor
+{
+    GENERATED_BODY()
+
+public:
+    UCattleMassMovementProcessor();
+
+protected:
+    virtual void ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) override;
+    virtual void Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) override;
+
+    FMassEntityQuery EntityQuery;
+};
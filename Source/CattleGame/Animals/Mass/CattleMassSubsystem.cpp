@@ -0,0 +1,388 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleMassSubsystem.h"
+#include "CattleMassAreaProcessor.h"
+#include "CattleMassFearProcessor.h"
+#include "CattleMassHerdProcessor.h"
+#include "CattleMassMovementProcessor.h"
+#include "CattleGame/Animals/CattleAnimal.h"
+#include "CattleGame/Animals/CattleAnimalMovementComponent.h"
+#include "CattleGame/Animals/Herd/CattleHerdSubsystem.h"
+#include "CattleGame/Animals/Stimuli/CattleStimulusSubsystem.h"
+#include "CattleGame/AbilitySystem/AnimalAttributeSet.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "MassEntitySubsystem.h"
+#include "MassExecutor.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+DECLARE_STATS_GROUP(TEXT("Cattle Mass"), STATGROUP_CattleMass, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Simulate"), STAT_CattleMass_Simulate, STATGROUP_CattleMass);
+DECLARE_CYCLE_STAT(TEXT("Promote"), STAT_CattleMass_Promote, STATGROUP_CattleMass);
+DECLARE_CYCLE_STAT(TEXT("Demote"), STAT_CattleMass_Demote, STATGROUP_CattleMass);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Entities"), STAT_CattleMass_Entities, STATGROUP_CattleMass);
+
+CSV_DEFINE_CATEGORY(CattleMass, true);
+
+void UCattleMassSubsystem::Initialize(FSubsystemCollectionBase &Collection)
+{
+    Super::Initialize(Collection);
+
+    UMassEntitySubsystem *EntitySubsystem = Collection.InitializeDependency<UMassEntitySubsystem>();
+    if (!bEnableMassCattle || !EntitySubsystem)
+    {
+        return;
+    }
+
+    EntityManager = EntitySubsystem->GetMutableEntityManager().AsShared();
+
+    Processors.Add(NewObject<UCattleMassAreaProcessor>(this));
+    Processors.Add(NewObject<UCattleMassHerdProcessor>(this));
+    Processors.Add(NewObject<UCattleMassFearProcessor>(this));
+    Processors.Add(NewObject<UCattleMassMovementProcessor>(this));
+
+    for (UMassProcessor *Processor : Processors)
+    {
+        Processor->CallInitialize(this, EntityManager.ToSharedRef());
+    }
+}
+
+void UCattleMassSubsystem::Deinitialize()
+{
+    if (EntityManager.IsValid())
+    {
+        for (const FMassEntityHandle Entity : Entities)
+        {
+            if (EntityManager->IsEntityValid(Entity))
+            {
+                EntityManager->DestroyEntity(Entity);
+            }
+        }
+    }
+
+    Entities.Empty();
+    Processors.Empty();
+    EntityManager.Reset();
+
+    Super::Deinitialize();
+}
+
+bool UCattleMassSubsystem::ShouldCreateSubsystem(UObject *Outer) const
+{
+    if (UWorld *World = Cast<UWorld>(Outer))
+    {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+TStatId UCattleMassSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCattleMassSubsystem, STATGROUP_Tickables);
+}
+
+bool UCattleMassSubsystem::IsMassEnabled() const
+{
+    // Animals are spawned and destroyed by the server only
+    return bEnableMassCattle && EntityManager.IsValid() && GetWorld()->GetNetMode() != NM_Client;
+}
+
+void UCattleMassSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (!IsMassEnabled())
+    {
+        return;
+    }
+
+    Simulate(DeltaTime);
+
+    SET_DWORD_STAT(STAT_CattleMass_Entities, Entities.Num());
+    CSV_CUSTOM_STAT(CattleMass, Entities, Entities.Num(), ECsvCustomStatOp::Set);
+
+    TimeUntilEvaluation -= DeltaTime;
+    if (TimeUntilEvaluation > 0.0f)
+    {
+        return;
+    }
+    TimeUntilEvaluation = EvaluationInterval;
+
+    TArray<FVector, TInlineAllocator<4>> PlayerLocations;
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        if (const APawn *Pawn = It->Get() ? It->Get()->GetPawn() : nullptr)
+        {
+            PlayerLocations.Add(Pawn->GetActorLocation());
+        }
+    }
+
+    // Without players there is nothing to measure distance against (e.g. before the first spawn)
+    if (PlayerLocations.Num() == 0)
+    {
+        return;
+    }
+
+    PromoteNearEntities(PlayerLocations);
+    DemoteDistantAnimals(PlayerLocations);
+}
+
+void UCattleMassSubsystem::Simulate(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_CattleMass_Simulate);
+    CSV_SCOPED_TIMING_STAT(CattleMass, Simulate);
+
+    const float StepTime = 1.0f / FMath::Max(SimulationRate, 1.0f);
+    SimulationTimeAccumulator = FMath::Min(SimulationTimeAccumulator + DeltaTime, StepTime * FMath::Max(MaxStepsPerFrame, 1));
+
+    while (SimulationTimeAccumulator >= StepTime)
+    {
+        SimulationTimeAccumulator -= StepTime;
+
+        FMassProcessingContext ProcessingContext(*EntityManager, StepTime);
+        UE::Mass::Executor::RunProcessorsView(ToRawPtrTArrayUnsafe(Processors), ProcessingContext);
+    }
+}
+
+FCattleMassParamsFragment UCattleMassSubsystem::MakeParams(const ACattleAnimal &Animal)
+{
+    FCattleMassParamsFragment Params;
+    Params.AnimalClass = Animal.GetClass();
+
+    if (const UAnimalAttributeSet *Attributes = Animal.GetAnimalAttributes())
+    {
+        Params.MaxFear = Attributes->GetMaxFear();
+        Params.FearDecayRate = Attributes->GetFearDecayRate();
+    }
+    if (const UCattleAnimalMovementComponent *Movement = Animal.GetAnimalMovement())
+    {
+        Params.GrazingSpeed = Movement->GrazingSpeed;
+        Params.WalkingSpeed = Movement->WalkingSpeed;
+        Params.PanicSpeed = Movement->PanicSpeed;
+        Params.AreaInfluenceStrength = Movement->AreaInfluenceStrength;
+        Params.FlowInfluenceStrength = Movement->FlowInfluenceStrength;
+    }
+    return Params;
+}
+
+FMassEntityHandle UCattleMassSubsystem::CreateEntity(const FCattleMassParamsFragment &Params, const FVector &Location, float Yaw, const FVector &Velocity, float Fear)
+{
+    FMassArchetypeSharedFragmentValues SharedValues;
+    SharedValues.AddConstSharedFragment(EntityManager->GetOrCreateConstSharedFragment(Params));
+    SharedValues.Sort();
+
+    FCattleMassTransformFragment Transform;
+    Transform.Location = Location;
+    Transform.Yaw = Yaw;
+
+    FCattleMassVelocityFragment VelocityFragment;
+    VelocityFragment.Velocity = Velocity;
+
+    FCattleMassFearFragment FearFragment;
+    FearFragment.Fear = Fear;
+
+    // Stagger the first area sample so entities demoted together do not sample together
+    FCattleMassAreaFragment Area;
+    Area.TimeUntilSample = FMath::FRand() * AreaSampleInterval;
+
+    const FInstancedStruct Fragments[] = {
+        FInstancedStruct::Make(Transform),
+        FInstancedStruct::Make(VelocityFragment),
+        FInstancedStruct::Make(FearFragment),
+        FInstancedStruct::Make(Area),
+        FInstancedStruct::Make(FCattleMassHerdFragment()),
+    };
+
+    const FMassEntityHandle Entity = EntityManager->CreateEntity(Fragments, SharedValues);
+    Entities.Add(Entity);
+    return Entity;
+}
+
+FMassEntityHandle UCattleMassSubsystem::SpawnAnimalEntity(TSubclassOf<ACattleAnimal> AnimalClass, const FVector &Location, float Yaw)
+{
+    const ACattleAnimal *DefaultAnimal = AnimalClass ? AnimalClass->GetDefaultObject<ACattleAnimal>() : nullptr;
+    if (!IsMassEnabled() || !DefaultAnimal)
+    {
+        return FMassEntityHandle();
+    }
+
+    return CreateEntity(MakeParams(*DefaultAnimal), Location, Yaw, FVector::ZeroVector, 0.0f);
+}
+
+FMassEntityHandle UCattleMassSubsystem::DemoteAnimal(ACattleAnimal *Animal)
+{
+    if (!IsMassEnabled() || !Animal || Animal->IsLassoed())
+    {
+        return FMassEntityHandle();
+    }
+
+    const float Fear = Animal->GetAnimalAttributes() ? Animal->GetAnimalAttributes()->GetFear() : 0.0f;
+    const FMassEntityHandle Entity = CreateEntity(MakeParams(*Animal), Animal->GetActorLocation(), Animal->GetActorRotation().Yaw, Animal->GetVelocity(), Fear);
+
+    // EndPlay unregisters it from the herd and area subsystems
+    Animal->Destroy();
+    return Entity;
+}
+
+ACattleAnimal *UCattleMassSubsystem::PromoteEntity(FMassEntityHandle Entity)
+{
+    const int32 Index = Entities.Find(Entity);
+    if (!IsMassEnabled() || Index == INDEX_NONE)
+    {
+        return nullptr;
+    }
+
+    Entities.RemoveAtSwap(Index, EAllowShrinking::No);
+    return SpawnAnimalForEntity(Entity);
+}
+
+void UCattleMassSubsystem::PromoteEntitiesInRadius(const FVector &Location, float Radius)
+{
+    if (!IsMassEnabled())
+    {
+        return;
+    }
+
+    const double RadiusSquared = FMath::Square(static_cast<double>(Radius));
+
+    for (int32 i = Entities.Num() - 1; i >= 0; --i)
+    {
+        const FMassEntityHandle Entity = Entities[i];
+        if (!EntityManager->IsEntityValid(Entity))
+        {
+            Entities.RemoveAtSwap(i, EAllowShrinking::No);
+        }
+        else if (FVector::DistSquared(EntityManager->GetFragmentDataChecked<FCattleMassTransformFragment>(Entity).Location, Location) <= RadiusSquared)
+        {
+            Entities.RemoveAtSwap(i, EAllowShrinking::No);
+            SpawnAnimalForEntity(Entity);
+        }
+    }
+}
+
+ACattleAnimal *UCattleMassSubsystem::SpawnAnimalForEntity(FMassEntityHandle Entity)
+{
+    if (!EntityManager->IsEntityValid(Entity))
+    {
+        return nullptr;
+    }
+
+    const FCattleMassTransformFragment Transform = EntityManager->GetFragmentDataChecked<FCattleMassTransformFragment>(Entity);
+    const FVector Velocity = EntityManager->GetFragmentDataChecked<FCattleMassVelocityFragment>(Entity).Velocity;
+    const float Fear = EntityManager->GetFragmentDataChecked<FCattleMassFearFragment>(Entity).Fear;
+    const TSubclassOf<ACattleAnimal> AnimalClass = EntityManager->GetConstSharedFragmentDataChecked<FCattleMassParamsFragment>(Entity).AnimalClass;
+
+    EntityManager->DestroyEntity(Entity);
+
+    UWorld *World = GetWorld();
+    FVector Location = Transform.Location;
+
+    // Entities keep the height they were demoted at; snap the animal to the ground under it
+    FHitResult GroundHit;
+    const FVector TraceOffset(0.0f, 0.0f, 5000.0f);
+    if (World->LineTraceSingleByChannel(GroundHit, Location + TraceOffset, Location - TraceOffset, ECC_Visibility))
+    {
+        Location = GroundHit.ImpactPoint;
+
+        if (const ACattleAnimal *DefaultAnimal = GetDefault<ACattleAnimal>(AnimalClass))
+        {
+            if (const UCapsuleComponent *Capsule = DefaultAnimal->GetCapsuleComponent())
+            {
+                Location.Z += Capsule->GetScaledCapsuleHalfHeight();
+            }
+        }
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    ACattleAnimal *Animal = World->SpawnActor<ACattleAnimal>(AnimalClass, Location, FRotator(0.0f, Transform.Yaw, 0.0f), SpawnParams);
+    if (!Animal)
+    {
+        return nullptr;
+    }
+
+    Animal->AddFear(Fear);
+
+    if (UCattleAnimalMovementComponent *Movement = Animal->GetAnimalMovement())
+    {
+        Movement->Velocity = Velocity;
+    }
+    return Animal;
+}
+
+void UCattleMassSubsystem::PromoteNearEntities(TConstArrayView<FVector> PlayerLocations)
+{
+    SCOPE_CYCLE_COUNTER(STAT_CattleMass_Promote);
+
+    const UCattleStimulusSubsystem *StimulusSubsystem = GetWorld()->GetSubsystem<UCattleStimulusSubsystem>();
+    const double PromoteDistanceSquared = FMath::Square(static_cast<double>(PromoteDistance));
+    int32 NumPromoted = 0;
+
+    for (int32 i = Entities.Num() - 1; i >= 0 && NumPromoted < MaxPromotionsPerEvaluation; --i)
+    {
+        const FMassEntityHandle Entity = Entities[i];
+        if (!EntityManager->IsEntityValid(Entity))
+        {
+            Entities.RemoveAtSwap(i, EAllowShrinking::No);
+            continue;
+        }
+
+        const FVector &Location = EntityManager->GetFragmentDataChecked<FCattleMassTransformFragment>(Entity).Location;
+
+        bool bPromote = false;
+        for (const FVector &PlayerLocation : PlayerLocations)
+        {
+            bPromote |= FVector::DistSquaredXY(Location, PlayerLocation) < PromoteDistanceSquared;
+        }
+
+        // Shots and explosions reaching the entity need a real animal to react to them
+        if (!bPromote && StimulusSubsystem)
+        {
+            StimulusSubsystem->ForEachStimulusAtLocation(Location, [&bPromote](const FCattleStimulus &Stimulus, double DistanceSquared)
+                                                         { bPromote |= Stimulus.Type == ECattleStimulusType::Gunshot || Stimulus.Type == ECattleStimulusType::Explosive; });
+        }
+
+        if (bPromote)
+        {
+            Entities.RemoveAtSwap(i, EAllowShrinking::No);
+            SpawnAnimalForEntity(Entity);
+            ++NumPromoted;
+        }
+    }
+}
+
+void UCattleMassSubsystem::DemoteDistantAnimals(TConstArrayView<FVector> PlayerLocations)
+{
+    SCOPE_CYCLE_COUNTER(STAT_CattleMass_Demote);
+
+    const UCattleHerdSubsystem *HerdSubsystem = GetWorld()->GetSubsystem<UCattleHerdSubsystem>();
+    if (!HerdSubsystem)
+    {
+        return;
+    }
+
+    const double DemoteDistanceSquared = FMath::Square(static_cast<double>(DemoteDistance));
+    int32 NumDemoted = 0;
+
+    for (int32 Index = 0; Index < HerdSubsystem->GetNumSlots() && NumDemoted < MaxDemotionsPerEvaluation; ++Index)
+    {
+        ACattleAnimal *Animal = HerdSubsystem->GetAnimal(Index);
+        if (!Animal || Animal->IsLassoed())
+        {
+            continue;
+        }
+
+        bool bNearPlayer = false;
+        for (const FVector &PlayerLocation : PlayerLocations)
+        {
+            bNearPlayer |= FVector::DistSquaredXY(HerdSubsystem->GetAnimalLocation(Index), PlayerLocation) < DemoteDistanceSquared;
+        }
+
+        if (!bNearPlayer && DemoteAnimal(Animal).IsSet())
+        {
+            ++NumDemoted;
+        }
+    }
+}
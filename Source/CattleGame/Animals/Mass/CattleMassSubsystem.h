@@ -0,0 +1,139 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityHandle.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CattleMassFragments.h"
+#include "CattleMassSubsystem.generated.h"
+
+class ACattleAnimal;
+class UMassProcessor;
+struct FMassEntityManager;
+
+/**
+ * UCattleMassSubsystem
+ *
+ * Optional Mass Entity backend for very large herds. Animals away from every
+ * player are demoted to lightweight entities (see CattleMassFragments.h) and
+ * their actors destroyed; the area, herd, fear and movement processors then
+ * simulate them at a fixed SimulationRate. Entities are promoted back to
+ * ACattleAnimal actors when a player comes within PromoteDistance or a
+ * gunshot or explosive stimulus reaches them. Lassoed animals are never
+ * demoted, and lassos and shots only reach animals near a player, so
+ * gameplay only ever touches actors.
+ *
+ * Server only, and off unless bEnableMassCattle is set in the Game config.
+ * Takes over from UCattleHerdProxySubsystem while enabled. Clients only see
+ * promoted animals; entities have no visual representation.
+ */
+UCLASS(Config = Game)
+class CATTLEGAME_API UCattleMassSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ===== Subsystem Lifecycle =====
+
+    virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** Whether entities are simulated in this world */
+    bool IsMassEnabled() const;
+
+    // ===== Entities =====
+
+    /** Create an animal directly as an entity, without spawning its actor first */
+    FMassEntityHandle SpawnAnimalEntity(TSubclassOf<ACattleAnimal> AnimalClass, const FVector &Location, float Yaw);
+
+    /** Replace a live animal with an entity; returns an invalid handle if it cannot be demoted */
+    FMassEntityHandle DemoteAnimal(ACattleAnimal *Animal);
+
+    /** Replace an entity with a live animal */
+    ACattleAnimal *PromoteEntity(FMassEntityHandle Entity);
+
+    /** Promote every entity within Radius of Location */
+    void PromoteEntitiesInRadius(const FVector &Location, float Radius);
+
+    /** Number of animals currently simulated as entities */
+    int32 GetNumEntities() const { return Entities.Num(); }
+
+    // ===== Configuration =====
+
+    /** Whether far-away animals are simulated as Mass entities */
+    UPROPERTY(Config)
+    bool bEnableMassCattle = false;
+
+    /** Entity simulation steps per second */
+    UPROPERTY(Config)
+    float SimulationRate = 30.0f;
+
+    /** Most simulation steps run in one frame; a slower frame drops time instead */
+    UPROPERTY(Config)
+    int32 MaxStepsPerFrame = 2;
+
+    /** Entities closer than this to any player become actors; keep above lasso and weapon range */
+    UPROPERTY(Config)
+    float PromoteDistance = 8000.0f;
+
+    /** Animals further than this from every player become entities; above PromoteDistance to avoid thrashing */
+    UPROPERTY(Config)
+    float DemoteDistance = 10000.0f;
+
+    /** Seconds between promote/demote checks */
+    UPROPERTY(Config)
+    float EvaluationInterval = 0.5f;
+
+    /** Actors spawned per check at most, so a player arriving at a herd does not hitch */
+    UPROPERTY(Config)
+    int32 MaxPromotionsPerEvaluation = 64;
+
+    /** Actors destroyed per check at most */
+    UPROPERTY(Config)
+    int32 MaxDemotionsPerEvaluation = 256;
+
+    /** Seconds between area and flow samples of one entity */
+    UPROPERTY(Config)
+    float AreaSampleInterval = 0.5f;
+
+    /** Fear (fraction of MaxFear) at which an entity moves at panic speed */
+    UPROPERTY(Config)
+    float PanicFearPercent = 0.7f;
+
+    /** Weight of herd steering against area and flow influence */
+    UPROPERTY(Config)
+    float HerdInfluenceStrength = 0.5f;
+
+protected:
+    /** Run the processors in fixed steps */
+    void Simulate(float DeltaTime);
+
+    /** Promote entities near players or reached by gunshots and explosives */
+    void PromoteNearEntities(TConstArrayView<FVector> PlayerLocations);
+
+    /** Demote animals far from every player */
+    void DemoteDistantAnimals(TConstArrayView<FVector> PlayerLocations);
+
+    /** Tuning shared by every entity of the animal's class */
+    static FCattleMassParamsFragment MakeParams(const ACattleAnimal &Animal);
+
+    FMassEntityHandle CreateEntity(const FCattleMassParamsFragment &Params, const FVector &Location, float Yaw, const FVector &Velocity, float Fear);
+
+    /** Spawn the actor for an entity and destroy the entity; Entities is not updated */
+    ACattleAnimal *SpawnAnimalForEntity(FMassEntityHandle Entity);
+
+    TSharedPtr<FMassEntityManager> EntityManager;
+
+    /** Area, herd, fear and movement, in execution order */
+    UPROPERTY()
+    TArray<TObjectPtr<UMassProcessor>> Processors;
+
+    TArray<FMassEntityHandle> Entities;
+
+    float SimulationTimeAccumulator = 0.0f;
+    float TimeUntilEvaluation = 0.0f;
+};
@@ -0,0 +1,144 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleNavQuerySubsystem.h"
+#include "NavigationData.h"
+#include "NavigationSystem.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+DECLARE_STATS_GROUP(TEXT("Cattle Navigation"), STATGROUP_CattleNavigation, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("ProcessProjections"), STAT_CattleNav_ProcessProjections, STATGROUP_CattleNavigation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Projections Completed"), STAT_CattleNav_Completed, STATGROUP_CattleNavigation);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pending Projections"), STAT_CattleNav_Pending, STATGROUP_CattleNavigation);
+
+CSV_DEFINE_CATEGORY(CattleNavigation, true);
+
+void UCattleNavQuerySubsystem::Deinitialize()
+{
+    PendingRequests.Empty();
+    RequestOrder.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UCattleNavQuerySubsystem::ShouldCreateSubsystem(UObject *Outer) const
+{
+    if (UWorld *World = Cast<UWorld>(Outer))
+    {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+TStatId UCattleNavQuerySubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCattleNavQuerySubsystem, STATGROUP_Tickables);
+}
+
+uint32 UCattleNavQuerySubsystem::RequestProjection(TConstArrayView<FVector> Candidates, FOnCattleNavProjectionComplete OnComplete)
+{
+    const uint32 RequestId = NextRequestId++;
+    if (NextRequestId == 0)
+    {
+        NextRequestId = 1;
+    }
+
+    FProjectionRequest &Request = PendingRequests.Add(RequestId);
+    Request.Candidates = Candidates;
+    Request.OnComplete = MoveTemp(OnComplete);
+    RequestOrder.PushLast(RequestId);
+
+    return RequestId;
+}
+
+void UCattleNavQuerySubsystem::CancelRequest(uint32 RequestId)
+{
+    PendingRequests.Remove(RequestId);
+}
+
+void UCattleNavQuerySubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    int32 NumCompleted = 0;
+    {
+        SCOPE_CYCLE_COUNTER(STAT_CattleNav_ProcessProjections);
+        CSV_SCOPED_TIMING_STAT(CattleNavigation, ProcessProjections);
+
+        const double Deadline = FPlatformTime::Seconds() + ProjectionBudgetMs * 0.001;
+
+        while (PendingRequests.Num() > 0)
+        {
+            if (NumCompleted >= MinRequestsPerFrame && FPlatformTime::Seconds() >= Deadline)
+            {
+                break;
+            }
+
+            NumCompleted += ProcessBatch();
+        }
+    }
+
+    // Only cancelled ids can be left; drop them
+    if (PendingRequests.Num() == 0)
+    {
+        RequestOrder.Reset();
+    }
+
+    INC_DWORD_STAT_BY(STAT_CattleNav_Completed, NumCompleted);
+    SET_DWORD_STAT(STAT_CattleNav_Pending, PendingRequests.Num());
+    CSV_CUSTOM_STAT(CattleNavigation, ProjectionsCompleted, NumCompleted, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(CattleNavigation, PendingProjections, PendingRequests.Num(), ECsvCustomStatOp::Set);
+}
+
+int32 UCattleNavQuerySubsystem::ProcessBatch()
+{
+    // Take requests out of the queue first; completion delegates may queue new ones
+    TArray<FProjectionRequest, TInlineAllocator<16>> Batch;
+    while (Batch.Num() < FMath::Max(RequestsPerBatch, 1) && !RequestOrder.IsEmpty())
+    {
+        const uint32 RequestId = RequestOrder.First();
+        RequestOrder.PopFirst();
+
+        FProjectionRequest Request;
+        if (PendingRequests.RemoveAndCopyValue(RequestId, Request))
+        {
+            Batch.Add(MoveTemp(Request));
+        }
+    }
+
+    TArray<FNavigationProjectionWork> Workload;
+    for (const FProjectionRequest &Request : Batch)
+    {
+        for (const FVector &Candidate : Request.Candidates)
+        {
+            Workload.Emplace(Candidate);
+        }
+    }
+
+    const UNavigationSystemV1 *NavSys = UNavigationSystemV1::GetCurrent<UNavigationSystemV1>(GetWorld());
+    const ANavigationData *NavData = NavSys ? NavSys->GetDefaultNavDataInstance() : nullptr;
+    if (NavData && Workload.Num() > 0)
+    {
+        NavData->BatchProjectPoints(Workload, ProjectionExtent);
+    }
+
+    int32 WorkIndex = 0;
+    for (FProjectionRequest &Request : Batch)
+    {
+        bool bSuccess = false;
+        FVector Location = FVector::ZeroVector;
+
+        for (int32 i = 0; i < Request.Candidates.Num(); ++i, ++WorkIndex)
+        {
+            if (!bSuccess && NavData && Workload[WorkIndex].bResult)
+            {
+                bSuccess = true;
+                Location = Workload[WorkIndex].OutLocation.Location;
+            }
+        }
+
+        Request.OnComplete.ExecuteIfBound(bSuccess, Location);
+    }
+
+    return Batch.Num();
+}
@@ -0,0 +1,86 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Deque.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CattleNavQuerySubsystem.generated.h"
+
+/** Result of a projection request: whether any candidate projected, and where */
+DECLARE_DELEGATE_TwoParams(FOnCattleNavProjectionComplete, bool /*bSuccess*/, const FVector & /*Location*/);
+
+/**
+ * UCattleNavQuerySubsystem
+ *
+ * Queues navmesh projections for cattle behavior tasks and resolves them over
+ * the following frames. Each frame pending requests are taken in batches and
+ * all their candidate points are projected with a single
+ * ANavigationData::BatchProjectPoints call, until the per-frame budget is spent.
+ * A panic that makes hundreds of animals pick flee targets at once is spread
+ * over several frames instead of landing in one.
+ *
+ * A request holds several candidate points; the first one (in order) that
+ * projects wins. Results are delivered through the request's delegate on the
+ * game thread, never from inside RequestProjection.
+ */
+UCLASS(Config = Game)
+class CATTLEGAME_API UCattleNavQuerySubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ===== Subsystem Lifecycle =====
+
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // ===== Requests =====
+
+    /** Queue a projection of Candidates onto the navmesh; returns an id for CancelRequest (never 0) */
+    uint32 RequestProjection(TConstArrayView<FVector> Candidates, FOnCattleNavProjectionComplete OnComplete);
+
+    /** Drop a pending request; its delegate will not be called */
+    void CancelRequest(uint32 RequestId);
+
+    /** Requests waiting to be processed */
+    int32 GetNumPendingRequests() const { return PendingRequests.Num(); }
+
+    // ===== Configuration =====
+
+    /** Time spent projecting per frame, in milliseconds */
+    UPROPERTY(Config)
+    float ProjectionBudgetMs = 0.5f;
+
+    /** Requests resolved per frame even when the budget is exhausted */
+    UPROPERTY(Config)
+    int32 MinRequestsPerFrame = 4;
+
+    /** Requests whose candidates go into one BatchProjectPoints call */
+    UPROPERTY(Config)
+    int32 RequestsPerBatch = 16;
+
+    /** Search extent around each candidate */
+    UPROPERTY(Config)
+    FVector ProjectionExtent = FVector(500.0f, 500.0f, 500.0f);
+
+protected:
+    struct FProjectionRequest
+    {
+        TArray<FVector, TInlineAllocator<10>> Candidates;
+        FOnCattleNavProjectionComplete OnComplete;
+    };
+
+    /** Project and complete up to RequestsPerBatch requests; returns how many were completed */
+    int32 ProcessBatch();
+
+    /** Pending requests by id; cancelling removes the entry */
+    TMap<uint32, FProjectionRequest> PendingRequests;
+
+    /** Request ids in submission order; ids no longer pending are skipped */
+    TDeque<uint32> RequestOrder;
+
+    uint32 NextRequestId = 1;
+};
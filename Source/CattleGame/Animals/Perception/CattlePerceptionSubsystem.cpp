@@ -0,0 +1,222 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattlePerceptionSubsystem.h"
+#include "CattleGame/Animals/CattleAnimal.h"
+#include "CattleGame/Animals/Herd/CattleHerdSubsystem.h"
+#include "CattleGame/Animals/Stimuli/CattleStimulusSubsystem.h"
+#include "CattleGame/Animals/Threats/CattleThreatSubsystem.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+DECLARE_STATS_GROUP(TEXT("Cattle Perception"), STATGROUP_CattlePerception, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Perceive Animals"), STAT_CattlePerception_Perceive, STATGROUP_CattlePerception);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Animals Perceived"), STAT_CattlePerception_AnimalsPerceived, STATGROUP_CattlePerception);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Max Staleness (s)"), STAT_CattlePerception_MaxStaleness, STATGROUP_CattlePerception);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Average Staleness (s)"), STAT_CattlePerception_AverageStaleness, STATGROUP_CattlePerception);
+
+CSV_DEFINE_CATEGORY(CattlePerception, true);
+
+void UCattlePerceptionSubsystem::Deinitialize()
+{
+    Perceptions.Empty();
+    Cursor = 0;
+
+    Super::Deinitialize();
+}
+
+bool UCattlePerceptionSubsystem::ShouldCreateSubsystem(UObject *Outer) const
+{
+    if (UWorld *World = Cast<UWorld>(Outer))
+    {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+TStatId UCattlePerceptionSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCattlePerceptionSubsystem, STATGROUP_Tickables);
+}
+
+const FCattlePerception *UCattlePerceptionSubsystem::GetPerception(const ACattleAnimal *Animal) const
+{
+    if (!Animal || !Perceptions.IsValidIndex(Animal->GetHerdIndex()))
+    {
+        return nullptr;
+    }
+
+    const FCattlePerception &Perception = Perceptions[Animal->GetHerdIndex()];
+    return Perception.Animal.Get() == Animal ? &Perception : nullptr;
+}
+
+void UCattlePerceptionSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    const UCattleHerdSubsystem *HerdSubsystem = GetWorld()->GetSubsystem<UCattleHerdSubsystem>();
+    if (!HerdSubsystem)
+    {
+        return;
+    }
+
+    const int32 NumSlots = HerdSubsystem->GetNumSlots();
+    if (Perceptions.Num() < NumSlots)
+    {
+        Perceptions.SetNum(NumSlots);
+    }
+
+    const double Now = GetWorld()->GetTimeSeconds();
+    int32 NumPerceived = 0;
+
+    {
+        SCOPE_CYCLE_COUNTER(STAT_CattlePerception_Perceive);
+        CSV_SCOPED_TIMING_STAT(CattlePerception, PerceiveAnimals);
+
+        const double Deadline = FPlatformTime::Seconds() + PerceptionBudgetMs * 0.001;
+
+        // Visit each slot at most once per frame, resuming where the last frame stopped
+        for (int32 Visited = 0; Visited < NumSlots; ++Visited)
+        {
+            if (NumPerceived >= MinAnimalsPerFrame && FPlatformTime::Seconds() >= Deadline)
+            {
+                break;
+            }
+
+            const int32 Index = Cursor;
+            Cursor = (Cursor + 1) % NumSlots;
+
+            ACattleAnimal *Animal = HerdSubsystem->GetAnimal(Index);
+            if (!Animal)
+            {
+                continue;
+            }
+
+            FCattlePerception &Perception = Perceptions[Index];
+            if (Perception.Animal.Get() != Animal)
+            {
+                // Slot reused by another animal; start from a clean result
+                Perception = FCattlePerception();
+                Perception.Animal = Animal;
+            }
+            else if (Now - Perception.LastUpdateTime < MinRefreshInterval * Animal->GetSignificanceIntervalScale())
+            {
+                continue;
+            }
+
+            PerceiveAnimal(Animal, Perception, HerdSubsystem->GetAnimalLocation(Index), Now);
+            ++NumPerceived;
+        }
+    }
+
+    INC_DWORD_STAT_BY(STAT_CattlePerception_AnimalsPerceived, NumPerceived);
+    CSV_CUSTOM_STAT(CattlePerception, AnimalsPerceived, NumPerceived, ECsvCustomStatOp::Set);
+
+    UpdateStaleness(*HerdSubsystem, Now);
+}
+
+void UCattlePerceptionSubsystem::PerceiveAnimal(ACattleAnimal *Animal, FCattlePerception &Perception, const FVector &Location, double Now) const
+{
+    Perception.LastUpdateTime = Now;
+
+    // ===== Threats =====
+
+    Perception.Threats.Reset();
+
+    if (const UCattleThreatSubsystem *ThreatSubsystem = GetWorld()->GetSubsystem<UCattleThreatSubsystem>())
+    {
+        // Every type is kept; which ones count is up to each CheckNearbyThreats service
+        ThreatSubsystem->ForEachThreatInRadius(Location, GetThreatRadius(), [&Perception, Animal](AActor *Actor, ECattleThreatType Type, double DistanceSquared)
+                                               {
+            if (Actor != Animal)
+            {
+                Perception.Threats.Add({Actor, Type, static_cast<float>(FMath::Sqrt(DistanceSquared))});
+            } });
+
+        Perception.Threats.Sort([](const FCattlePerceivedThreat &A, const FCattlePerceivedThreat &B)
+                                { return A.Distance < B.Distance; });
+
+        if (Perception.Threats.Num() > MaxPerceivedThreats)
+        {
+            Perception.Threats.SetNum(FMath::Max(MaxPerceivedThreats, 1), EAllowShrinking::No);
+        }
+    }
+
+    // ===== Player Actions =====
+
+    Perception.NearestExplosive.Reset();
+    Perception.Lurer.Reset();
+    Perception.Scarer.Reset();
+    Perception.Shooter.Reset();
+
+    const UCattleStimulusSubsystem *StimulusSubsystem = GetWorld()->GetSubsystem<UCattleStimulusSubsystem>();
+    if (!StimulusSubsystem)
+    {
+        return;
+    }
+
+    double NearestExplosiveDistanceSquared = FMath::Square(static_cast<double>(ExplosiveDetectionRadius));
+    const double TrumpetRadiusSquared = FMath::Square(static_cast<double>(TrumpetDetectionRadius));
+    const double GunshotRadiusSquared = FMath::Square(static_cast<double>(GunshotDetectionRadius));
+
+    // Only stimuli whose radius reaches this animal are visited
+    StimulusSubsystem->ForEachStimulusAtLocation(Location, [&](const FCattleStimulus &Stimulus, double DistanceSquared)
+                                                 {
+        switch (Stimulus.Type)
+        {
+        case ECattleStimulusType::Explosive:
+            if (DistanceSquared < NearestExplosiveDistanceSquared)
+            {
+                NearestExplosiveDistanceSquared = DistanceSquared;
+                Perception.NearestExplosive = Stimulus.Source;
+            }
+            break;
+
+        case ECattleStimulusType::Lure:
+            if (DistanceSquared <= TrumpetRadiusSquared)
+            {
+                Perception.Lurer = Stimulus.Instigator;
+            }
+            break;
+
+        case ECattleStimulusType::Scare:
+            if (DistanceSquared <= TrumpetRadiusSquared)
+            {
+                Perception.Scarer = Stimulus.Instigator;
+            }
+            break;
+
+        case ECattleStimulusType::Gunshot:
+            if (DistanceSquared <= GunshotRadiusSquared && Now - Stimulus.StartTime < GunshotMemoryTime)
+            {
+                Perception.Shooter = Stimulus.Instigator;
+            }
+            break;
+        } });
+}
+
+void UCattlePerceptionSubsystem::UpdateStaleness(const UCattleHerdSubsystem &HerdSubsystem, double Now)
+{
+    double MaxAge = 0.0;
+    double TotalAge = 0.0;
+    int32 NumAnimals = 0;
+
+    for (int32 Index = 0; Index < Perceptions.Num(); ++Index)
+    {
+        const FCattlePerception &Perception = Perceptions[Index];
+        if (Perception.Animal.IsValid() && Perception.Animal.Get() == HerdSubsystem.GetAnimal(Index))
+        {
+            const double Age = Now - Perception.LastUpdateTime;
+            MaxAge = FMath::Max(MaxAge, Age);
+            TotalAge += Age;
+            ++NumAnimals;
+        }
+    }
+
+    MaxStaleness = static_cast<float>(MaxAge);
+    AverageStaleness = NumAnimals > 0 ? static_cast<float>(TotalAge / NumAnimals) : 0.0f;
+
+    SET_FLOAT_STAT(STAT_CattlePerception_MaxStaleness, MaxStaleness);
+    SET_FLOAT_STAT(STAT_CattlePerception_AverageStaleness, AverageStaleness);
+    CSV_CUSTOM_STAT(CattlePerception, MaxStalenessMs, MaxStaleness * 1000.0f, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(CattlePerception, AverageStalenessMs, AverageStaleness * 1000.0f, ECsvCustomStatOp::Set);
+}
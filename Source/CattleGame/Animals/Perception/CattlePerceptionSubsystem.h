@@ -0,0 +1,146 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CattleGame/Animals/Threats/CattleThreatSubsystem.h"
+#include "CattlePerceptionSubsystem.generated.h"
+
+class ACattleAnimal;
+class UCattleHerdSubsystem;
+
+/** A registered threat an animal perceived */
+struct FCattlePerceivedThreat
+{
+    TWeakObjectPtr<AActor> Actor;
+    ECattleThreatType Type = ECattleThreatType::Other;
+    float Distance = 0.0f;
+};
+
+/**
+ * FCattlePerception
+ *
+ * What an animal last perceived about threats and player actions around it.
+ */
+struct FCattlePerception
+{
+    /** Animal this result belongs to; herd slots are reused */
+    TWeakObjectPtr<ACattleAnimal> Animal;
+
+    /** World time of the last refresh */
+    double LastUpdateTime = 0.0;
+
+    /** Threats within the threat radius, nearest first; services pick the first their own filter accepts */
+    TArray<FCattlePerceivedThreat, TInlineAllocator<4>> Threats;
+
+    /** Nearest lit explosive within ExplosiveDetectionRadius */
+    TWeakObjectPtr<AActor> NearestExplosive;
+
+    /** Players luring or scaring the animal with a trumpet */
+    TWeakObjectPtr<AActor> Lurer;
+    TWeakObjectPtr<AActor> Scarer;
+
+    /** Player who fired nearby within GunshotMemoryTime */
+    TWeakObjectPtr<AActor> Shooter;
+};
+
+/**
+ * UCattlePerceptionSubsystem
+ *
+ * Owns threat and player-action perception for all cattle. Animals are
+ * refreshed round-robin in herd slot order until the per-frame time budget
+ * runs out, so perception cost never spikes no matter how service ticks line
+ * up. Behavior tree services only copy the cached results to the blackboard.
+ *
+ * An animal is not refreshed more often than MinRefreshInterval (stretched by
+ * its significance tier). How long results go without a refresh is reported
+ * to "stat CattlePerception" and the CSV profiler for budget tuning.
+ */
+UCLASS(Config = Game)
+class CATTLEGAME_API UCattlePerceptionSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ===== Subsystem Lifecycle =====
+
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // ===== Queries =====
+
+    /** Latest perception for an animal, or nullptr if it has not been perceived yet */
+    const FCattlePerception *GetPerception(const ACattleAnimal *Animal) const;
+
+    /** Longest time any animal has gone without a refresh, as of the last tick */
+    float GetMaxStaleness() const { return MaxStaleness; }
+
+    /** Mean time since refresh over all animals, as of the last tick */
+    float GetAverageStaleness() const { return AverageStaleness; }
+
+    /** Perceive threats out to at least Radius; CheckNearbyThreats services request their detection radius */
+    void RequestThreatRadius(float Radius) { RequestedThreatRadius = FMath::Max(RequestedThreatRadius, Radius); }
+
+    /** Radius threats are currently perceived at */
+    float GetThreatRadius() const { return FMath::Max(MinThreatRadius, RequestedThreatRadius); }
+
+    // ===== Configuration =====
+
+    /** Time spent refreshing animals per frame, in milliseconds */
+    UPROPERTY(Config)
+    float PerceptionBudgetMs = 0.5f;
+
+    /** Animals refreshed per frame even when the budget is exhausted */
+    UPROPERTY(Config)
+    int32 MinAnimalsPerFrame = 1;
+
+    /** Shortest time between refreshes of one animal, scaled by its significance */
+    UPROPERTY(Config)
+    float MinRefreshInterval = 0.2f;
+
+    /** Radius threats are perceived at even when no service requests one (dormancy wakes on any threat in it) */
+    UPROPERTY(Config)
+    float MinThreatRadius = 1500.0f;
+
+    /** Most threats kept per animal, nearest first */
+    UPROPERTY(Config)
+    int32 MaxPerceivedThreats = 8;
+
+    /** Radius to detect lit explosives */
+    UPROPERTY(Config)
+    float ExplosiveDetectionRadius = 800.0f;
+
+    /** Radius to detect trumpet effects */
+    UPROPERTY(Config)
+    float TrumpetDetectionRadius = 1500.0f;
+
+    /** Radius to detect gunshots */
+    UPROPERTY(Config)
+    float GunshotDetectionRadius = 1500.0f;
+
+    /** Time after last gunshot to still consider "shooting" */
+    UPROPERTY(Config)
+    float GunshotMemoryTime = 2.0f;
+
+protected:
+    /** Refresh one animal's perception */
+    void PerceiveAnimal(ACattleAnimal *Animal, FCattlePerception &Perception, const FVector &Location, double Now) const;
+
+    /** Update the staleness figures and report them */
+    void UpdateStaleness(const UCattleHerdSubsystem &HerdSubsystem, double Now);
+
+    /** Results indexed by herd slot */
+    TArray<FCattlePerception> Perceptions;
+
+    /** Next herd slot to consider */
+    int32 Cursor = 0;
+
+    /** Largest radius requested through RequestThreatRadius */
+    float RequestedThreatRadius = 0.0f;
+
+    float MaxStaleness = 0.0f;
+    float AverageStaleness = 0.0f;
+};
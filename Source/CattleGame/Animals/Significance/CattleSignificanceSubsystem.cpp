@@ -0,0 +1,156 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleSignificanceSubsystem.h"
+#include "CattleGame/Animals/CattleAnimal.h"
+#include "CattleGame/Animals/CattleAnimalMovementComponent.h"
+#include "CattleGame/Animals/Herd/CattleHerdSubsystem.h"
+#include "GameFramework/PlayerController.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+DECLARE_STATS_GROUP(TEXT("Cattle Significance"), STATGROUP_CattleSignificance, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("EvaluateSignificance"), STAT_CattleSignificance_Evaluate, STATGROUP_CattleSignificance);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Tier 0 Animals"), STAT_CattleSignificance_Tier0, STATGROUP_CattleSignificance);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Tier 1 Animals"), STAT_CattleSignificance_Tier1, STATGROUP_CattleSignificance);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Tier 2 Animals"), STAT_CattleSignificance_Tier2, STATGROUP_CattleSignificance);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Tier 3 Animals"), STAT_CattleSignificance_Tier3, STATGROUP_CattleSignificance);
+
+CSV_DEFINE_CATEGORY(CattleSignificance, true);
+
+UCattleSignificanceSubsystem::UCattleSignificanceSubsystem()
+{
+    // Defaults when the Game config does not override them
+    Tiers.Emplace(0.0f, 1.0f, 0.0f);
+    Tiers.Emplace(2500.0f, 2.0f, 1.0f / 30.0f);
+    Tiers.Emplace(6000.0f, 4.0f, 0.1f);
+    Tiers.Emplace(12000.0f, 8.0f, 0.25f);
+}
+
+bool UCattleSignificanceSubsystem::ShouldCreateSubsystem(UObject *Outer) const
+{
+    if (UWorld *World = Cast<UWorld>(Outer))
+    {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+void UCattleSignificanceSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    TimeUntilEvaluation -= DeltaTime;
+    if (TimeUntilEvaluation <= 0.0f)
+    {
+        TimeUntilEvaluation = EvaluationInterval;
+        EvaluateSignificance();
+    }
+
+    CSV_CUSTOM_STAT(CattleSignificance, Tier0, GetNumAnimalsInTier(0), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(CattleSignificance, Tier1, GetNumAnimalsInTier(1), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(CattleSignificance, Tier2, GetNumAnimalsInTier(2), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(CattleSignificance, Tier3, GetNumAnimalsInTier(3), ECsvCustomStatOp::Set);
+}
+
+TStatId UCattleSignificanceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCattleSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+int32 UCattleSignificanceSubsystem::GetTierForDistance(float Distance) const
+{
+    int32 Tier = 0;
+    for (int32 i = 1; i < GetNumTiers(); ++i)
+    {
+        if (Distance >= Tiers[i].MinDistance)
+        {
+            Tier = i;
+        }
+    }
+    return Tier;
+}
+
+void UCattleSignificanceSubsystem::EvaluateSignificance()
+{
+    SCOPE_CYCLE_COUNTER(STAT_CattleSignificance_Evaluate);
+
+    const UCattleHerdSubsystem *HerdSubsystem = GetWorld()->GetSubsystem<UCattleHerdSubsystem>();
+    const int32 NumTiers = GetNumTiers();
+    if (!HerdSubsystem || NumTiers == 0)
+    {
+        return;
+    }
+
+    struct FPlayerView
+    {
+        FVector Location;
+        FVector Direction;
+    };
+
+    TArray<FPlayerView, TInlineAllocator<4>> PlayerViews;
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController *PlayerController = It->Get();
+        if (PlayerController && PlayerController->GetPawn())
+        {
+            FVector ViewLocation;
+            FRotator ViewRotation;
+            PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+            PlayerViews.Add({ViewLocation, ViewRotation.Vector()});
+        }
+    }
+
+    TierCounts.Init(0, NumTiers);
+    const float CosViewHalfAngle = FMath::Cos(FMath::DegreesToRadians(ViewHalfAngle));
+
+    for (int32 Index = 0; Index < HerdSubsystem->GetNumSlots(); ++Index)
+    {
+        ACattleAnimal *Animal = HerdSubsystem->GetAnimal(Index);
+        if (!Animal)
+        {
+            continue;
+        }
+
+        // Without players nothing is significant
+        int32 Tier = NumTiers - 1;
+        if (PlayerViews.Num() > 0)
+        {
+            const FVector &AnimalLocation = HerdSubsystem->GetAnimalLocation(Index);
+            float BestDistance = TNumericLimits<float>::Max();
+
+            for (const FPlayerView &View : PlayerViews)
+            {
+                const FVector ToAnimal = AnimalLocation - View.Location;
+                const float Distance = ToAnimal.Size();
+                const bool bInView = Distance <= KINDA_SMALL_NUMBER || FVector::DotProduct(ToAnimal / Distance, View.Direction) >= CosViewHalfAngle;
+                BestDistance = FMath::Min(BestDistance, bInView ? Distance : Distance * OffscreenDistanceScale);
+            }
+
+            Tier = GetTierForDistance(BestDistance);
+        }
+
+        ++TierCounts[Tier];
+        if (Tier != Animal->GetSignificanceTier())
+        {
+            ApplyTier(Animal, Tier);
+        }
+    }
+
+    SET_DWORD_STAT(STAT_CattleSignificance_Tier0, GetNumAnimalsInTier(0));
+    SET_DWORD_STAT(STAT_CattleSignificance_Tier1, GetNumAnimalsInTier(1));
+    SET_DWORD_STAT(STAT_CattleSignificance_Tier2, GetNumAnimalsInTier(2));
+    SET_DWORD_STAT(STAT_CattleSignificance_Tier3, GetNumAnimalsInTier(3));
+}
+
+void UCattleSignificanceSubsystem::ApplyTier(ACattleAnimal *Animal, int32 Tier) const
+{
+    const FCattleSignificanceTier &Settings = Tiers[Tier];
+
+    Animal->SignificanceTier = Tier;
+    Animal->SignificanceIntervalScale = FMath::Max(Settings.IntervalScale, 1.0f);
+
+    if (UCattleAnimalMovementComponent *Movement = Animal->GetAnimalMovement())
+    {
+        Movement->SetSimulationInterval(Settings.MovementTickInterval);
+    }
+}
@@ -0,0 +1,108 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CattleSignificanceSubsystem.generated.h"
+
+class ACattleAnimal;
+
+/**
+ * Update rates for one significance tier
+ */
+USTRUCT()
+struct FCattleSignificanceTier
+{
+    GENERATED_BODY()
+
+    FCattleSignificanceTier() = default;
+
+    FCattleSignificanceTier(float InMinDistance, float InIntervalScale, float InMovementTickInterval)
+        : MinDistance(InMinDistance), IntervalScale(InIntervalScale), MovementTickInterval(InMovementTickInterval)
+    {
+    }
+
+    /** Animals at least this far (significance distance) from every player fall into this tier or lower */
+    UPROPERTY(Config)
+    float MinDistance = 0.0f;
+
+    /** Multiplier on behavior service intervals and the area update interval */
+    UPROPERTY(Config)
+    float IntervalScale = 1.0f;
+
+    /** Seconds between movement simulation steps with authority (0 = every frame); the mesh is interpolated in between */
+    UPROPERTY(Config)
+    float MovementTickInterval = 0.0f;
+};
+
+/**
+ * UCattleSignificanceSubsystem
+ *
+ * Ranks every animal by its distance to the nearest player, with animals
+ * outside all players' view cones counted as further away, and sorts them
+ * into a few tiers. Each tier scales how often the animal's behavior services,
+ * area updates and movement run, so distant cattle cost a fraction of nearby
+ * ones. Tier 0 is the most significant and runs at full rate.
+ *
+ * Per-tier animal counts are reported to "stat CattleSignificance" and to the
+ * CSV profiler.
+ */
+UCLASS(Config = Game)
+class CATTLEGAME_API UCattleSignificanceSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UCattleSignificanceSubsystem();
+
+    // ===== Subsystem Lifecycle =====
+
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // ===== Queries =====
+
+    /** Number of animals in a tier at the last evaluation */
+    int32 GetNumAnimalsInTier(int32 Tier) const { return TierCounts.IsValidIndex(Tier) ? TierCounts[Tier] : 0; }
+
+    /** Number of configured tiers */
+    int32 GetNumTiers() const { return FMath::Min(Tiers.Num(), MaxTiers); }
+
+    /** Highest number of tiers supported */
+    static constexpr int32 MaxTiers = 4;
+
+    // ===== Configuration =====
+
+    /** Tiers from most to least significant, by ascending MinDistance */
+    UPROPERTY(Config)
+    TArray<FCattleSignificanceTier> Tiers;
+
+    /** Seconds between significance evaluations */
+    UPROPERTY(Config)
+    float EvaluationInterval = 0.25f;
+
+    /** Half angle of a player's view cone in degrees */
+    UPROPERTY(Config)
+    float ViewHalfAngle = 60.0f;
+
+    /** Distance multiplier for animals outside every player's view cone */
+    UPROPERTY(Config)
+    float OffscreenDistanceScale = 2.0f;
+
+protected:
+    /** Tier whose MinDistance range contains the significance distance */
+    int32 GetTierForDistance(float Distance) const;
+
+    /** Rank all animals and apply tier changes */
+    void EvaluateSignificance();
+
+    /** Push a tier's update rates onto an animal */
+    void ApplyTier(ACattleAnimal *Animal, int32 Tier) const;
+
+    /** Animals per tier at the last evaluation */
+    TArray<int32, TFixedAllocator<MaxTiers>> TierCounts;
+
+    float TimeUntilEvaluation = 0.0f;
+};
@@ -0,0 +1,123 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleStimulusSubsystem.h"
+#include "GameFramework/Actor.h"
+
+void UCattleStimulusSubsystem::Deinitialize()
+{
+    Stimuli.Empty();
+    StimulusGrid.Reset();
+
+    Super::Deinitialize();
+}
+
+bool UCattleStimulusSubsystem::ShouldCreateSubsystem(UObject *Outer) const
+{
+    if (UWorld *World = Cast<UWorld>(Outer))
+    {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+void UCattleStimulusSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (Stimuli.Num() == 0)
+    {
+        return;
+    }
+
+    const double Now = GetWorld()->GetTimeSeconds();
+
+    for (auto It = Stimuli.CreateIterator(); It; ++It)
+    {
+        FCattleStimulus &Stimulus = It->Stimulus;
+        const bool bExpired = Stimulus.ExpireTime > 0.0 && Now >= Stimulus.ExpireTime;
+
+        // A stimulus ends with its source
+        if (bExpired || !Stimulus.Source.IsValid())
+        {
+            StimulusGrid.Remove(It.GetIndex());
+            It.RemoveCurrent();
+            continue;
+        }
+
+        const FVector NewLocation = Stimulus.Source->GetActorLocation();
+        if (!NewLocation.Equals(Stimulus.Location, 1.0))
+        {
+            Stimulus.Location = NewLocation;
+            StimulusGrid.Update(It.GetIndex(), GetStimulusBounds(Stimulus));
+        }
+    }
+}
+
+TStatId UCattleStimulusSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCattleStimulusSubsystem, STATGROUP_Tickables);
+}
+
+FBox2D UCattleStimulusSubsystem::GetStimulusBounds(const FCattleStimulus &Stimulus)
+{
+    const FVector2D Center(Stimulus.Location);
+    const FVector2D Extent(Stimulus.Radius, Stimulus.Radius);
+    return FBox2D(Center - Extent, Center + Extent);
+}
+
+FCattleStimulusHandle UCattleStimulusSubsystem::PublishStimulus(ECattleStimulusType Type, AActor *Source, AActor *Instigator, float Radius, float Duration)
+{
+    if (!Source || Radius <= 0.0f)
+    {
+        return FCattleStimulusHandle();
+    }
+
+    const double Now = GetWorld()->GetTimeSeconds();
+
+    FStimulusSlot Slot;
+    Slot.Stimulus.Type = Type;
+    Slot.Stimulus.Source = Source;
+    Slot.Stimulus.Instigator = Instigator;
+    Slot.Stimulus.Location = Source->GetActorLocation();
+    Slot.Stimulus.Radius = Radius;
+    Slot.Stimulus.StartTime = Now;
+    Slot.Stimulus.ExpireTime = Duration > 0.0f ? Now + Duration : 0.0;
+    Slot.Serial = NextStimulusSerial++;
+
+    FCattleStimulusHandle Handle;
+    Handle.Serial = Slot.Serial;
+    Handle.Index = Stimuli.Add(MoveTemp(Slot));
+
+    StimulusGrid.Insert(Handle.Index, GetStimulusBounds(Stimuli[Handle.Index].Stimulus));
+    return Handle;
+}
+
+void UCattleStimulusSubsystem::RemoveStimulus(FCattleStimulusHandle &Handle)
+{
+    if (Handle.IsValid() && Stimuli.IsValidIndex(Handle.Index) && Stimuli[Handle.Index].Serial == Handle.Serial)
+    {
+        StimulusGrid.Remove(Handle.Index);
+        Stimuli.RemoveAt(Handle.Index);
+    }
+
+    Handle = FCattleStimulusHandle();
+}
+
+void UCattleStimulusSubsystem::ForEachStimulusAtLocation(const FVector &Location, TFunctionRef<void(const FCattleStimulus &, double)> Func) const
+{
+    if (Stimuli.Num() == 0)
+    {
+        return;
+    }
+
+    StimulusGrid.ForEachItemAtLocation(FVector2D(Location), [this, &Location, &Func](int32 Index)
+                                       {
+        const FCattleStimulus &Stimulus = Stimuli[Index].Stimulus;
+
+        // The grid tests bounds; trim the corners to the actual radius
+        const double DistanceSquared = FVector::DistSquared(Location, Stimulus.Location);
+        if (DistanceSquared <= FMath::Square(static_cast<double>(Stimulus.Radius)))
+        {
+            Func(Stimulus, DistanceSquared);
+        } });
+}
@@ -0,0 +1,121 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CattleGame/Animals/Areas/CattleAreaSpatialGrid.h"
+#include "CattleStimulusSubsystem.generated.h"
+
+/**
+ * Player action an animal can react to
+ */
+UENUM(BlueprintType)
+enum class ECattleStimulusType : uint8
+{
+    Explosive UMETA(DisplayName = "Explosive"),
+    Lure UMETA(DisplayName = "Lure"),
+    Scare UMETA(DisplayName = "Scare"),
+    Gunshot UMETA(DisplayName = "Gunshot")
+};
+
+/**
+ * FCattleStimulusHandle
+ *
+ * Identifies a published stimulus. The serial guards against a slot being
+ * reused after the stimulus it referred to expired.
+ */
+struct FCattleStimulusHandle
+{
+    int32 Index = INDEX_NONE;
+    uint32 Serial = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+
+    bool operator==(const FCattleStimulusHandle &Other) const { return Index == Other.Index && Serial == Other.Serial; }
+    bool operator!=(const FCattleStimulusHandle &Other) const { return !(*this == Other); }
+};
+
+/**
+ * FCattleStimulus
+ *
+ * A timed, radius-bounded player action. A stimulus follows its source
+ * every frame and ends when the source is destroyed.
+ */
+struct FCattleStimulus
+{
+    ECattleStimulusType Type = ECattleStimulusType::Explosive;
+
+    /** Actor the stimulus emanates from (dynamite, player) */
+    TWeakObjectPtr<AActor> Source;
+
+    /** Player responsible for the stimulus */
+    TWeakObjectPtr<AActor> Instigator;
+
+    FVector Location = FVector::ZeroVector;
+    float Radius = 0.0f;
+
+    /** World time the stimulus was published */
+    double StartTime = 0.0;
+
+    /** World time the stimulus ends (0 = until removed) */
+    double ExpireTime = 0.0;
+};
+
+/**
+ * UCattleStimulusSubsystem
+ *
+ * Event bus for player actions that affect cattle. Weapons publish stimuli
+ * when something happens (trumpet starts playing, revolver fires, dynamite
+ * fuse is lit) instead of animals polling players and their inventories.
+ * Stimuli are kept in a spatial grid by their radius so an animal only sees
+ * the few stimuli that reach its location, and costs nothing when no player
+ * is acting.
+ */
+UCLASS()
+class CATTLEGAME_API UCattleStimulusSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ===== Subsystem Lifecycle =====
+
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // ===== Publishing =====
+
+    /**
+     * Publish a stimulus reaching Radius around Source.
+     * Duration <= 0 keeps it alive until RemoveStimulus or until Source is destroyed.
+     */
+    FCattleStimulusHandle PublishStimulus(ECattleStimulusType Type, AActor *Source, AActor *Instigator, float Radius, float Duration = 0.0f);
+
+    /** End a stimulus early and reset the handle */
+    void RemoveStimulus(FCattleStimulusHandle &Handle);
+
+    // ===== Queries =====
+
+    /** Call Func(Stimulus, DistanceSquared) for every stimulus whose radius reaches Location */
+    void ForEachStimulusAtLocation(const FVector &Location, TFunctionRef<void(const FCattleStimulus &, double)> Func) const;
+
+    /** Number of live stimuli */
+    int32 GetNumStimuli() const { return Stimuli.Num(); }
+
+private:
+    struct FStimulusSlot
+    {
+        FCattleStimulus Stimulus;
+        uint32 Serial = 0;
+    };
+
+    TSparseArray<FStimulusSlot> Stimuli;
+    uint32 NextStimulusSerial = 1;
+
+    /** Stimulus bounds keyed by slot index */
+    FCattleAreaSpatialGrid StimulusGrid{2000.0f};
+
+    static FBox2D GetStimulusBounds(const FCattleStimulus &Stimulus);
+};
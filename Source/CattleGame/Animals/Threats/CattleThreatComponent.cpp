@@ -0,0 +1,28 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleThreatComponent.h"
+
+UCattleThreatComponent::UCattleThreatComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UCattleThreatComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (UCattleThreatSubsystem *ThreatSubsystem = GetWorld()->GetSubsystem<UCattleThreatSubsystem>())
+    {
+        ThreatSubsystem->RegisterThreat(GetOwner(), ThreatType);
+    }
+}
+
+void UCattleThreatComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UCattleThreatSubsystem *ThreatSubsystem = GetWorld()->GetSubsystem<UCattleThreatSubsystem>())
+    {
+        ThreatSubsystem->UnregisterThreat(GetOwner());
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
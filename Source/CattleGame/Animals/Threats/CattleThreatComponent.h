@@ -0,0 +1,30 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "CattleThreatSubsystem.h"
+#include "CattleThreatComponent.generated.h"
+
+/**
+ * UCattleThreatComponent
+ *
+ * Marks its owner as a threat to cattle by registering it with
+ * UCattleThreatSubsystem for as long as the component is playing.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class CATTLEGAME_API UCattleThreatComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UCattleThreatComponent();
+
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    /** What kind of threat the owner is */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Threat")
+    ECattleThreatType ThreatType = ECattleThreatType::Other;
+};
@@ -0,0 +1,207 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleThreatSubsystem.h"
+#include "GameFramework/Actor.h"
+
+void UCattleThreatSubsystem::Initialize(FSubsystemCollectionBase &Collection)
+{
+    Super::Initialize(Collection);
+
+    BuiltCellSize = FMath::Max(ThreatCellSize, 1.0f);
+}
+
+void UCattleThreatSubsystem::Deinitialize()
+{
+    Threats.Empty();
+    ThreatSlots.Empty();
+    SortedSlots.Empty();
+    CellRanges.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UCattleThreatSubsystem::ShouldCreateSubsystem(UObject *Outer) const
+{
+    if (UWorld *World = Cast<UWorld>(Outer))
+    {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+void UCattleThreatSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    RefreshSnapshot();
+}
+
+TStatId UCattleThreatSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCattleThreatSubsystem, STATGROUP_Tickables);
+}
+
+void UCattleThreatSubsystem::RegisterThreat(AActor *Actor, ECattleThreatType ThreatType)
+{
+    if (!Actor)
+    {
+        return;
+    }
+
+    const FObjectKey Key(Actor);
+    if (const int32 *ExistingSlot = ThreatSlots.Find(Key))
+    {
+        Threats[*ExistingSlot].Type = ThreatType;
+        return;
+    }
+
+    FThreatEntry Entry;
+    Entry.Actor = Actor;
+    Entry.Key = Key;
+    Entry.Type = ThreatType;
+    Entry.Location = Actor->GetActorLocation();
+    Entry.Cell = GetCellAtLocation(Entry.Location);
+
+    ThreatSlots.Add(Key, Threats.Add(MoveTemp(Entry)));
+}
+
+void UCattleThreatSubsystem::UnregisterThreat(AActor *Actor)
+{
+    int32 Slot;
+    if (!Actor || !ThreatSlots.RemoveAndCopyValue(FObjectKey(Actor), Slot))
+    {
+        return;
+    }
+
+    // The slot stays in the hash until the next snapshot; queries skip freed slots
+    Threats.RemoveAt(Slot);
+}
+
+FIntPoint UCattleThreatSubsystem::GetCellAtLocation(const FVector &Location) const
+{
+    return FIntPoint(
+        FMath::FloorToInt32(Location.X / BuiltCellSize),
+        FMath::FloorToInt32(Location.Y / BuiltCellSize));
+}
+
+void UCattleThreatSubsystem::RefreshSnapshot()
+{
+    BuiltCellSize = FMath::Max(ThreatCellSize, 1.0f);
+    SortedSlots.Reset();
+
+    for (auto It = Threats.CreateIterator(); It; ++It)
+    {
+        FThreatEntry &Entry = *It;
+        const AActor *Actor = Entry.Actor.Get();
+
+        // Destroyed without EndPlay (e.g. level streaming); free the slot here
+        if (!Actor)
+        {
+            ThreatSlots.Remove(Entry.Key);
+            It.RemoveCurrent();
+            continue;
+        }
+
+        Entry.Location = Actor->GetActorLocation();
+        Entry.Cell = GetCellAtLocation(Entry.Location);
+        SortedSlots.Add(It.GetIndex());
+    }
+
+    SortedSlots.Sort([this](int32 A, int32 B)
+                     {
+        const FIntPoint &CellA = Threats[A].Cell;
+        const FIntPoint &CellB = Threats[B].Cell;
+        return CellA.Y != CellB.Y ? CellA.Y < CellB.Y : (CellA.X != CellB.X ? CellA.X < CellB.X : A < B); });
+
+    CellRanges.Reset();
+
+    for (int32 Start = 0; Start < SortedSlots.Num();)
+    {
+        const FIntPoint Cell = Threats[SortedSlots[Start]].Cell;
+
+        int32 End = Start + 1;
+        while (End < SortedSlots.Num() && Threats[SortedSlots[End]].Cell == Cell)
+        {
+            ++End;
+        }
+
+        CellRanges.Add(Cell, FIntPoint(Start, End - Start));
+        Start = End;
+    }
+}
+
+void UCattleThreatSubsystem::ForEachThreatInRadius(const FVector &Location, float Radius, TFunctionRef<void(AActor *, ECattleThreatType, double)> Func) const
+{
+    if (Radius <= 0.0f || CellRanges.Num() == 0)
+    {
+        return;
+    }
+
+    const double RadiusSquared = FMath::Square(static_cast<double>(Radius));
+    const FIntPoint MinCell = GetCellAtLocation(Location - FVector(Radius, Radius, 0.0f));
+    const FIntPoint MaxCell = GetCellAtLocation(Location + FVector(Radius, Radius, 0.0f));
+
+    auto VisitRange = [&](const FIntPoint &Range)
+    {
+        for (int32 Entry = Range.X; Entry < Range.X + Range.Y; ++Entry)
+        {
+            const int32 Slot = SortedSlots[Entry];
+            if (!Threats.IsValidIndex(Slot))
+            {
+                continue;
+            }
+
+            const FThreatEntry &Threat = Threats[Slot];
+            AActor *Actor = Threat.Actor.Get();
+            if (!Actor)
+            {
+                continue;
+            }
+
+            const double DistanceSquared = FVector::DistSquared(Location, Threat.Location);
+            if (DistanceSquared <= RadiusSquared)
+            {
+                Func(Actor, Threat.Type, DistanceSquared);
+            }
+        }
+    };
+
+    const int64 NumCells = static_cast<int64>(MaxCell.X - MinCell.X + 1) * static_cast<int64>(MaxCell.Y - MinCell.Y + 1);
+    if (NumCells > CellRanges.Num())
+    {
+        // Query covers more cells than are occupied; scan the occupied ones instead
+        for (const TPair<FIntPoint, FIntPoint> &Pair : CellRanges)
+        {
+            VisitRange(Pair.Value);
+        }
+        return;
+    }
+
+    for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+    {
+        for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+        {
+            if (const FIntPoint *Range = CellRanges.Find(FIntPoint(X, Y)))
+            {
+                VisitRange(*Range);
+            }
+        }
+    }
+}
+
+AActor *UCattleThreatSubsystem::FindNearestThreat(const FVector &Location, float Radius, TFunctionRef<bool(const AActor *, ECattleThreatType)> Filter, float &OutDistance) const
+{
+    AActor *NearestThreat = nullptr;
+    double NearestDistanceSquared = TNumericLimits<double>::Max();
+
+    ForEachThreatInRadius(Location, Radius, [&](AActor *Actor, ECattleThreatType Type, double DistanceSquared)
+                          {
+        if (DistanceSquared < NearestDistanceSquared && Filter(Actor, Type))
+        {
+            NearestDistanceSquared = DistanceSquared;
+            NearestThreat = Actor;
+        } });
+
+    OutDistance = NearestThreat ? static_cast<float>(FMath::Sqrt(NearestDistanceSquared)) : 0.0f;
+    return NearestThreat;
+}
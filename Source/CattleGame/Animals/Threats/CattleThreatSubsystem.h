@@ -0,0 +1,107 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "CattleThreatSubsystem.generated.h"
+
+/**
+ * What kind of threat a registered actor is
+ */
+UENUM(BlueprintType)
+enum class ECattleThreatType : uint8
+{
+    Player UMETA(DisplayName = "Player"),
+    Explosive UMETA(DisplayName = "Explosive"),
+    Other UMETA(DisplayName = "Other")
+};
+
+/**
+ * UCattleThreatSubsystem
+ *
+ * World subsystem holding every actor animals should be wary of (players,
+ * dynamite, anything with a UCattleThreatComponent). Threat locations are
+ * snapshotted once per frame into a uniform XY spatial hash so nearest-threat
+ * queries only visit the cells around the animal instead of scanning the world.
+ *
+ * Threats register themselves in BeginPlay and unregister in EndPlay. A threat
+ * registered mid-frame becomes visible to queries on the next snapshot.
+ */
+UCLASS(Config = Game)
+class CATTLEGAME_API UCattleThreatSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ===== Subsystem Lifecycle =====
+
+    virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // ===== Registration =====
+
+    /** Add an actor to the threat registry (re-registering updates its type) */
+    void RegisterThreat(AActor *Actor, ECattleThreatType ThreatType);
+
+    /** Remove an actor from the threat registry */
+    void UnregisterThreat(AActor *Actor);
+
+    // ===== Queries =====
+
+    /** Call Func(Actor, Type, DistanceSquared) for every threat within Radius of Location */
+    void ForEachThreatInRadius(const FVector &Location, float Radius, TFunctionRef<void(AActor *, ECattleThreatType, double)> Func) const;
+
+    /**
+     * Nearest threat within Radius of Location that passes Filter, or nullptr.
+     * OutDistance receives the distance to the returned threat.
+     */
+    AActor *FindNearestThreat(const FVector &Location, float Radius, TFunctionRef<bool(const AActor *, ECattleThreatType)> Filter, float &OutDistance) const;
+
+    /** Number of registered threats */
+    int32 GetNumThreats() const { return ThreatSlots.Num(); }
+
+    // ===== Configuration =====
+
+    /** Size of a spatial hash cell in world units; about the typical detection radius works best */
+    UPROPERTY(Config)
+    float ThreatCellSize = 1500.0f;
+
+protected:
+    // ===== Threat Data (indexed by slot) =====
+
+    struct FThreatEntry
+    {
+        TWeakObjectPtr<AActor> Actor;
+        FObjectKey Key;
+        ECattleThreatType Type = ECattleThreatType::Other;
+        FVector Location = FVector::ZeroVector;
+        FIntPoint Cell = FIntPoint::ZeroValue;
+    };
+
+    TSparseArray<FThreatEntry> Threats;
+
+    /** Actor -> slot in Threats */
+    TMap<FObjectKey, int32> ThreatSlots;
+
+    // ===== Spatial Hash =====
+
+    /** Threat slots ordered by cell, so each cell's threats are contiguous */
+    TArray<int32> SortedSlots;
+
+    /** Cell coordinate -> (first entry in SortedSlots, entry count) */
+    TMap<FIntPoint, FIntPoint> CellRanges;
+
+    /** Cell size the hash was last built with */
+    float BuiltCellSize = 1500.0f;
+
+    /** Cell coordinate containing a world XY location */
+    FIntPoint GetCellAtLocation(const FVector &Location) const;
+
+    /** Snapshot threat locations and rebuild the spatial hash */
+    void RefreshSnapshot();
+};
@@ -0,0 +1,354 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CattleTickSubsystem.h"
+#include "CattleGame/Animals/CattleAnimal.h"
+#include "CattleGame/Animals/CattleAnimalMovementComponent.h"
+#include "CattleGame/AbilitySystem/AnimalAttributeSet.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_STATS_GROUP(TEXT("Cattle Tick"), STATGROUP_CattleTick, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("UpdateState"), STAT_CattleTick_Update, STATGROUP_CattleTick);
+DECLARE_CYCLE_STAT(TEXT("ApplyState"), STAT_CattleTick_Apply, STATGROUP_CattleTick);
+DECLARE_CYCLE_STAT(TEXT("ResolveImpulses"), STAT_CattleTick_Impulses, STATGROUP_CattleTick);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Ticked Animals"), STAT_CattleTick_Animals, STATGROUP_CattleTick);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Resolved Impulses"), STAT_CattleTick_NumImpulses, STATGROUP_CattleTick);
+
+void FCattleTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef &MyCompletionGraphEvent)
+{
+    if (Target && TickType != LEVELTICK_ViewportsOnly)
+    {
+        Target->TickAnimals(DeltaTime);
+    }
+}
+
+FString FCattleTickFunction::DiagnosticMessage()
+{
+    return TEXT("UCattleTickSubsystem::TickAnimals");
+}
+
+FName FCattleTickFunction::DiagnosticContext(bool bDetailed)
+{
+    return FName(TEXT("CattleTickSubsystem"));
+}
+
+void UCattleTickSubsystem::OnWorldBeginPlay(UWorld &InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    TickFunction.bCanEverTick = true;
+    TickFunction.bStartWithTickEnabled = true;
+    TickFunction.TickGroup = TG_PrePhysics;
+    TickFunction.Target = this;
+    TickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UCattleTickSubsystem::Deinitialize()
+{
+    if (TickFunction.IsTickFunctionRegistered())
+    {
+        TickFunction.UnRegisterTickFunction();
+    }
+    TickFunction.Target = nullptr;
+
+    for (ACattleAnimal *Animal : Animals)
+    {
+        if (Animal)
+        {
+            Animal->TickIndex = INDEX_NONE;
+        }
+    }
+
+    Animals.Empty();
+    Movements.Empty();
+    AreaUpdateTimers.Empty();
+    FearDecays.Empty();
+    AreaRefreshFlags.Empty();
+    ResolvingImpulses.Empty();
+    PendingRegistrations.Empty();
+
+    while (ImpulseQueue.Dequeue())
+    {
+    }
+
+    Super::Deinitialize();
+}
+
+bool UCattleTickSubsystem::ShouldCreateSubsystem(UObject *Outer) const
+{
+    if (UWorld *World = Cast<UWorld>(Outer))
+    {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+void UCattleTickSubsystem::RegisterAnimal(ACattleAnimal *Animal)
+{
+    if (!Animal || Animal->TickIndex != INDEX_NONE)
+    {
+        return;
+    }
+
+    // Appending now would hand the apply loop an entry the update stage never filled
+    if (bTickingAnimals)
+    {
+        PendingRegistrations.AddUnique(Animal);
+        return;
+    }
+
+    Animal->TickIndex = Animals.Add(Animal);
+    Movements.Add(Animal->GetAnimalMovement());
+    AreaUpdateTimers.Add(0.0f);
+    FearDecays.Add(0.0f);
+    AreaRefreshFlags.Add(0);
+
+    // Movement integrates the impulses this tick resolves
+    if (UCattleAnimalMovementComponent *Movement = Animal->GetAnimalMovement())
+    {
+        Movement->PrimaryComponentTick.AddPrerequisite(this, TickFunction);
+    }
+}
+
+void UCattleTickSubsystem::UnregisterAnimal(ACattleAnimal *Animal)
+{
+    if (!Animal)
+    {
+        return;
+    }
+
+    PendingRegistrations.Remove(Animal);
+
+    if (!Animals.IsValidIndex(Animal->TickIndex) || Animals[Animal->TickIndex] != Animal)
+    {
+        return;
+    }
+
+    if (UCattleAnimalMovementComponent *Movement = Animal->GetAnimalMovement())
+    {
+        Movement->PrimaryComponentTick.RemovePrerequisite(this, TickFunction);
+    }
+
+    const int32 Index = Animal->TickIndex;
+    Animal->TickIndex = INDEX_NONE;
+
+    // Swapping now would move an animal the loops have not reached yet; empty the entry and compact afterwards
+    if (bTickingAnimals)
+    {
+        Animals[Index] = nullptr;
+        Movements[Index] = nullptr;
+        bHasRemovedEntries = true;
+        return;
+    }
+
+    // Keep the arrays dense; the last animal takes over the freed index
+    Animals.RemoveAtSwap(Index, EAllowShrinking::No);
+    Movements.RemoveAtSwap(Index, EAllowShrinking::No);
+    AreaUpdateTimers.RemoveAtSwap(Index, EAllowShrinking::No);
+    FearDecays.RemoveAtSwap(Index, EAllowShrinking::No);
+    AreaRefreshFlags.RemoveAtSwap(Index, EAllowShrinking::No);
+
+    if (Animals.IsValidIndex(Index) && Animals[Index])
+    {
+        Animals[Index]->TickIndex = Index;
+    }
+}
+
+void UCattleTickSubsystem::FlushPendingRegistrations()
+{
+    if (bHasRemovedEntries)
+    {
+        bHasRemovedEntries = false;
+
+        for (int32 Index = Animals.Num() - 1; Index >= 0; --Index)
+        {
+            if (Animals[Index])
+            {
+                continue;
+            }
+
+            Animals.RemoveAtSwap(Index, EAllowShrinking::No);
+            Movements.RemoveAtSwap(Index, EAllowShrinking::No);
+            AreaUpdateTimers.RemoveAtSwap(Index, EAllowShrinking::No);
+            FearDecays.RemoveAtSwap(Index, EAllowShrinking::No);
+            AreaRefreshFlags.RemoveAtSwap(Index, EAllowShrinking::No);
+
+            if (Animals.IsValidIndex(Index) && Animals[Index])
+            {
+                Animals[Index]->TickIndex = Index;
+            }
+        }
+    }
+
+    TArray<TObjectPtr<ACattleAnimal>> Registrations = MoveTemp(PendingRegistrations);
+    PendingRegistrations.Reset();
+    for (ACattleAnimal *Animal : Registrations)
+    {
+        RegisterAnimal(Animal);
+    }
+}
+
+void UCattleTickSubsystem::QueueImpulse(ACattleAnimal *Animal, const FVector &Impulse, bool bVelocityChange)
+{
+    if (Animal)
+    {
+        ImpulseQueue.Enqueue(FQueuedImpulse{Animal, Impulse, bVelocityChange});
+    }
+}
+
+void UCattleTickSubsystem::ResolveImpulses()
+{
+    SCOPE_CYCLE_COUNTER(STAT_CattleTick_Impulses);
+
+    ResolvingImpulses.Reset();
+    while (TOptional<FQueuedImpulse> Queued = ImpulseQueue.Dequeue())
+    {
+        if (ACattleAnimal *Animal = Queued->Animal.Get())
+        {
+            ResolvingImpulses.Emplace(Animal, MoveTemp(*Queued));
+        }
+    }
+
+    SET_DWORD_STAT(STAT_CattleTick_NumImpulses, ResolvingImpulses.Num());
+
+    if (ResolvingImpulses.Num() == 0)
+    {
+        return;
+    }
+
+    // Queue order depends on thread timing; a fixed order makes the float sums repeatable
+    ResolvingImpulses.Sort([](const TPair<ACattleAnimal *, FQueuedImpulse> &A, const TPair<ACattleAnimal *, FQueuedImpulse> &B)
+                           {
+        if (A.Key != B.Key)
+        {
+            return A.Key->GetUniqueID() < B.Key->GetUniqueID();
+        }
+        const FVector &ImpulseA = A.Value.Impulse;
+        const FVector &ImpulseB = B.Value.Impulse;
+        if (ImpulseA.X != ImpulseB.X)
+        {
+            return ImpulseA.X < ImpulseB.X;
+        }
+        if (ImpulseA.Y != ImpulseB.Y)
+        {
+            return ImpulseA.Y < ImpulseB.Y;
+        }
+        if (ImpulseA.Z != ImpulseB.Z)
+        {
+            return ImpulseA.Z < ImpulseB.Z;
+        }
+        return A.Value.bVelocityChange < B.Value.bVelocityChange; });
+
+    for (int32 First = 0; First < ResolvingImpulses.Num();)
+    {
+        ACattleAnimal *Animal = ResolvingImpulses[First].Key;
+
+        FVector VelocityChange = FVector::ZeroVector;
+        FVector Impulse = FVector::ZeroVector;
+
+        int32 Next = First;
+        for (; Next < ResolvingImpulses.Num() && ResolvingImpulses[Next].Key == Animal; ++Next)
+        {
+            const FQueuedImpulse &Queued = ResolvingImpulses[Next].Value;
+            (Queued.bVelocityChange ? VelocityChange : Impulse) += Queued.Impulse;
+        }
+        First = Next;
+
+        // Dormant animals are not ticked; this registers them again
+        Animal->WakeFromDormancy();
+
+        if (UCattleAnimalMovementComponent *Movement = Animal->GetAnimalMovement())
+        {
+            Movement->AddPhysicsImpulses(VelocityChange, Impulse);
+        }
+    }
+
+    ResolvingImpulses.Reset();
+}
+
+void UCattleTickSubsystem::TickAnimals(float DeltaTime)
+{
+    ResolveImpulses();
+
+    SET_DWORD_STAT(STAT_CattleTick_Animals, Animals.Num());
+
+    if (Animals.Num() == 0)
+    {
+        return;
+    }
+
+    // Registrations from listeners and wake-ups wait until both stages are done
+    TGuardValue<bool> TickingGuard(bTickingAnimals, true);
+    const int32 NumAnimals = Animals.Num();
+
+    {
+        SCOPE_CYCLE_COUNTER(STAT_CattleTick_Update);
+
+        // Each task writes only its own entries, so no locking is needed
+        ParallelFor(
+            TEXT("CattleTickUpdate"), NumAnimals, FMath::Max(ParallelBatchSize, 1),
+            [this, DeltaTime](int32 Index)
+            { UpdateAnimalState(Index, DeltaTime); });
+    }
+
+    {
+        SCOPE_CYCLE_COUNTER(STAT_CattleTick_Apply);
+
+        for (int32 Index = 0; Index < NumAnimals; ++Index)
+        {
+            ApplyAnimalState(Index, DeltaTime);
+        }
+    }
+
+    bTickingAnimals = false;
+    FlushPendingRegistrations();
+}
+
+void UCattleTickSubsystem::UpdateAnimalState(int32 Index, float DeltaTime)
+{
+    const ACattleAnimal *Animal = Animals[Index];
+    if (!Animal)
+    {
+        AreaRefreshFlags[Index] = 0;
+        return;
+    }
+
+    // Check for tracking cell changes periodically
+    float &AreaUpdateTimer = AreaUpdateTimers[Index];
+    AreaUpdateTimer += DeltaTime;
+    AreaRefreshFlags[Index] = AreaUpdateTimer >= Animal->AreaUpdateInterval * Animal->SignificanceIntervalScale;
+    if (AreaRefreshFlags[Index])
+    {
+        AreaUpdateTimer = 0.0f;
+    }
+
+    FearDecays[Index] = Animal->GetFearDecay(DeltaTime);
+}
+
+void UCattleTickSubsystem::ApplyAnimalState(int32 Index, float DeltaTime)
+{
+    ACattleAnimal *Animal = Animals[Index];
+    if (!Animal)
+    {
+        return;
+    }
+
+    if (AreaRefreshFlags[Index])
+    {
+        Animal->UpdateAreaInfluences();
+    }
+
+    Animal->ProcessAreaInfluences(DeltaTime);
+
+    if (UCattleAnimalMovementComponent *Movement = Movements[Index])
+    {
+        Movement->UpdateVisualInterpolation(DeltaTime);
+    }
+
+    // Fear may have been added since the update stage (area listeners, other animals); only remove the decay
+    UAnimalAttributeSet *Attributes = Animal->AnimalAttributes;
+    if (Attributes && FearDecays[Index] > 0.0f)
+    {
+        Attributes->SetFear(FMath::Max(0.0f, Attributes->GetFear() - FearDecays[Index]));
+    }
+}
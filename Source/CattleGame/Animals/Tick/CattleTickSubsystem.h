@@ -0,0 +1,156 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/MpscQueue.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CattleTickSubsystem.generated.h"
+
+class ACattleAnimal;
+class UCattleAnimalMovementComponent;
+class UCattleTickSubsystem;
+
+/** Tick function that advances every registered animal in one go */
+USTRUCT()
+struct FCattleTickFunction : public FTickFunction
+{
+    GENERATED_BODY()
+
+    UCattleTickSubsystem *Target = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef &MyCompletionGraphEvent) override;
+    virtual FString DiagnosticMessage() override;
+    virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template <>
+struct TStructOpsTypeTraits<FCattleTickFunction> : public TStructOpsTypeTraitsBase2<FCattleTickFunction>
+{
+    enum
+    {
+        WithCopy = false
+    };
+};
+
+/**
+ * UCattleTickSubsystem
+ *
+ * Replaces the per-animal actor tick with a single tick function in
+ * TG_PrePhysics. Registered animals are kept in dense arrays (swap-removed on
+ * unregistration) and advanced in two stages:
+ *
+ * - Update, in parallel: area refresh timers and fear decay. Each task reads
+ *   its own animal and writes only its own entries.
+ * - Apply, on the game thread: area refreshes, movement speed and influence,
+ *   mesh interpolation for reduced-rate movement, and fear attribute writes.
+ *
+ * Physics impulses are buffered rather than applied where they happen. Any
+ * thread may queue one; the buffer is resolved at the start of each tick,
+ * summing every animal's impulses in a fixed order and clamping once, so the
+ * result does not depend on which source ran first.
+ *
+ * Every animal's movement component has this tick function as a prerequisite,
+ * so resolved impulses are in place before movement integrates them.
+ */
+UCLASS(Config = Game)
+class CATTLEGAME_API UCattleTickSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ===== Subsystem Lifecycle =====
+
+    virtual void OnWorldBeginPlay(UWorld &InWorld) override;
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+
+    // ===== Registration =====
+
+    /** Start ticking an animal */
+    void RegisterAnimal(ACattleAnimal *Animal);
+
+    /** Stop ticking an animal */
+    void UnregisterAnimal(ACattleAnimal *Animal);
+
+    /** Number of ticked animals */
+    int32 GetNumAnimals() const { return Animals.Num(); }
+
+    /** The shared tick function, for adding prerequisites */
+    FCattleTickFunction &GetTickFunction() { return TickFunction; }
+
+    // ===== Impulses =====
+
+    /** Buffer a physics impulse for the next tick; safe to call from any thread */
+    void QueueImpulse(ACattleAnimal *Animal, const FVector &Impulse, bool bVelocityChange);
+
+    // ===== Configuration =====
+
+    /** Animals per parallel update task; smaller herds run on the game thread */
+    UPROPERTY(Config)
+    int32 ParallelBatchSize = 64;
+
+protected:
+    friend struct FCattleTickFunction;
+
+    /** Resolve impulses, then run both stages for every registered animal */
+    void TickAnimals(float DeltaTime);
+
+    /** Apply every buffered impulse, one clamped velocity change per animal */
+    void ResolveImpulses();
+
+    /** Pure-math stage for one animal; touches only its own entries */
+    void UpdateAnimalState(int32 Index, float DeltaTime);
+
+    /** Engine-facing writes for one animal, on the game thread */
+    void ApplyAnimalState(int32 Index, float DeltaTime);
+
+    FCattleTickFunction TickFunction;
+
+    struct FQueuedImpulse
+    {
+        TWeakObjectPtr<ACattleAnimal> Animal;
+        FVector Impulse = FVector::ZeroVector;
+        bool bVelocityChange = false;
+    };
+
+    /** Filled by any thread, drained on the game thread */
+    TMpscQueue<FQueuedImpulse> ImpulseQueue;
+
+    // ===== Deferred Registration =====
+
+    /** Set while the update and apply stages walk the arrays */
+    bool bTickingAnimals = false;
+
+    /** Animals registered during the stages, added once they finish */
+    TArray<TObjectPtr<ACattleAnimal>> PendingRegistrations;
+
+    /** Whether an unregistration during the stages left an empty entry to compact */
+    bool bHasRemovedEntries = false;
+
+    /** Drop entries emptied during the stages and add pending registrations */
+    void FlushPendingRegistrations();
+
+    /** Scratch for ResolveImpulses */
+    TArray<TPair<ACattleAnimal *, FQueuedImpulse>> ResolvingImpulses;
+
+    // ===== Animal Data (dense, indexed by ACattleAnimal::TickIndex) =====
+
+    UPROPERTY()
+    TArray<TObjectPtr<ACattleAnimal>> Animals;
+
+    UPROPERTY()
+    TArray<TObjectPtr<UCattleAnimalMovementComponent>> Movements;
+
+    /** Seconds since each animal last checked its tracking cell */
+    TArray<float> AreaUpdateTimers;
+
+    // ===== Update Results (indexed like Animals) =====
+
+    /** Fear lost to this frame's decay; applied as a delta so fear added meanwhile is kept */
+    TArray<float> FearDecays;
+
+    /** Non-zero when the animal is due an area refresh */
+    TArray<uint8> AreaRefreshFlags;
+};
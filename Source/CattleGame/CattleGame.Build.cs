@@ -20,6 +20,7 @@ public class CattleGame : ModuleRules
 			"GameplayTags",
 			"GameplayTasks",
 			"CableComponent",
+			"MassEntity",        // Optional entity backend for large herds
 			"RenderCore",        // For render target operations
 			"RHI"                // For GPU resource access
 		});
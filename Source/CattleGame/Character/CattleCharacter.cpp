@@ -16,6 +16,7 @@
 #include "CattleGame/CattleGame.h"
 #include "Net/UnrealNetwork.h"
 #include "CattleGame/Player/CattlePlayerController.h"
+#include "CattleGame/Animals/Threats/CattleThreatSubsystem.h"
 
 // Console variable for development/testing: override mesh visibility
 // Type "r.ShowAllMeshes 1" in console to show both meshes, "r.ShowAllMeshes 0" to restore normal behavior
@@ -97,6 +98,12 @@ void ACattleCharacter::BeginPlay()
 	// Grant abilities from Data Asset (server only)
 	InitAbilitySystem();
 
+	// Cattle treat players as threats
+	if (UCattleThreatSubsystem *ThreatSubsystem = GetWorld()->GetSubsystem<UCattleThreatSubsystem>())
+	{
+		ThreatSubsystem->RegisterThreat(this, ECattleThreatType::Player);
+	}
+
 	// Input mapping: if using our custom PlayerController, it owns the mapping lifecycle. Otherwise keep a safe fallback here.
 	if (!Cast<ACattlePlayerController>(Controller))
 	{
@@ -115,6 +122,16 @@ void ACattleCharacter::BeginPlay()
 	}
 }
 
+void ACattleCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UCattleThreatSubsystem *ThreatSubsystem = GetWorld()->GetSubsystem<UCattleThreatSubsystem>())
+	{
+		ThreatSubsystem->UnregisterThreat(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ACattleCharacter::PawnClientRestart()
 {
 	Super::PawnClientRestart();
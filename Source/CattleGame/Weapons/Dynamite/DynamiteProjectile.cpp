@@ -9,6 +9,8 @@
 #include "GameplayCueManager.h"
 #include "CattleGame/AbilitySystem/CattleGameplayTags.h"
 #include "CattleGame/Animals/CattleAnimal.h"
+#include "CattleGame/Animals/Fear/CattleFearFieldSubsystem.h"
+#include "CattleGame/Animals/Threats/CattleThreatSubsystem.h"
 #include "Engine/OverlapResult.h"
 #include "CattleGame/CattleGame.h"
 
@@ -53,6 +55,11 @@ void ADynamiteProjectile::BeginPlay()
 		CollisionSphere->OnComponentHit.AddDynamic(this, &ADynamiteProjectile::OnCollision);
 	}
 
+	if (UCattleThreatSubsystem *ThreatSubsystem = GetWorld()->GetSubsystem<UCattleThreatSubsystem>())
+	{
+		ThreatSubsystem->RegisterThreat(this, ECattleThreatType::Explosive);
+	}
+
 	// Server only: Start fuse timer
 	if (HasAuthority())
 	{
@@ -66,9 +73,30 @@ void ADynamiteProjectile::BeginPlay()
 			false);
 
 		UE_LOG(LogGASDebug, Warning, TEXT("DynamiteProjectile::BeginPlay - Fuse started, explosion in %.1f seconds"), FuseTime);
+
+		// Cattle notice the lit fuse; the stimulus ends when the projectile is destroyed
+		if (UCattleStimulusSubsystem *StimulusSubsystem = GetWorld()->GetSubsystem<UCattleStimulusSubsystem>())
+		{
+			FuseStimulus = StimulusSubsystem->PublishStimulus(ECattleStimulusType::Explosive, this, GetInstigator(), FuseFearRadius);
+		}
 	}
 }
 
+void ADynamiteProjectile::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UCattleThreatSubsystem *ThreatSubsystem = GetWorld()->GetSubsystem<UCattleThreatSubsystem>())
+	{
+		ThreatSubsystem->UnregisterThreat(this);
+	}
+
+	if (UCattleStimulusSubsystem *StimulusSubsystem = GetWorld()->GetSubsystem<UCattleStimulusSubsystem>())
+	{
+		StimulusSubsystem->RemoveStimulus(FuseStimulus);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ADynamiteProjectile::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -207,11 +235,9 @@ void ADynamiteProjectile::Explode()
 					this,
 					UDamageType::StaticClass());
 
-				// Apply fear and impulse to cattle
+				// Apply impulse to cattle; fear goes through the fear field below
 				if (ACattleAnimal *Cattle = Cast<ACattleAnimal>(HitActor))
 				{
-					Cattle->AddFear(ExplosionFearAmount);
-
 					// Calculate impulse direction away from explosion
 					FVector ImpulseDir = (Cattle->GetActorLocation() - ExplosionCenter).GetSafeNormal();
 					if (ImpulseDir.IsNearlyZero())
@@ -220,8 +246,7 @@ void ADynamiteProjectile::Explode()
 					}
 					Cattle->ApplyPhysicsImpulse(ImpulseDir * ExplosionImpulseForce, true);
 
-					UE_LOG(LogGASDebug, Warning, TEXT("DynamiteProjectile::Explode - Applied fear %.0f and impulse to %s"),
-						   ExplosionFearAmount, *Cattle->GetName());
+					UE_LOG(LogGASDebug, Warning, TEXT("DynamiteProjectile::Explode - Applied impulse to %s"), *Cattle->GetName());
 				}
 
 				UE_LOG(LogGASDebug, Warning, TEXT("DynamiteProjectile::Explode - Damaged %s for %.0f"), *HitActor->GetName(), ExplosionDamage);
@@ -229,6 +254,11 @@ void ADynamiteProjectile::Explode()
 		}
 	}
 
+	if (UCattleFearFieldSubsystem *FearField = GetWorld()->GetSubsystem<UCattleFearFieldSubsystem>())
+	{
+		FearField->AddFear(ExplosionCenter, ExplosionRadius, ExplosionFearAmount);
+	}
+
 	UE_LOG(LogGASDebug, Warning, TEXT("DynamiteProjectile::Explode - Explosion at %s, radius %.0f, damage %.0f"),
 		   *GetActorLocation().ToString(), ExplosionRadius, ExplosionDamage);
 
@@ -247,33 +277,9 @@ void ADynamiteProjectile::GetLifetimeReplicatedProps(TArray<FLifetimeProperty> &
 
 void ADynamiteProjectile::ApplyFuseFearToNearbyCattle(float DeltaTime)
 {
-	if (!GetWorld())
-	{
-		return;
-	}
-
-	const FVector DynamiteLocation = GetActorLocation();
-	TArray<FOverlapResult> OverlapResults;
-	FCollisionShape SphereShape = FCollisionShape::MakeSphere(FuseFearRadius);
-
-	if (GetWorld()->OverlapMultiByChannel(
-			OverlapResults,
-			DynamiteLocation,
-			FQuat::Identity,
-			ECC_Pawn,
-			SphereShape))
+	if (UCattleFearFieldSubsystem *FearField = GetWorld() ? GetWorld()->GetSubsystem<UCattleFearFieldSubsystem>() : nullptr)
 	{
-		for (const FOverlapResult &Overlap : OverlapResults)
-		{
-			if (ACattleAnimal *Cattle = Cast<ACattleAnimal>(Overlap.GetActor()))
-			{
-				// Apply fear based on proximity - closer = more fear
-				const float Distance = FVector::Dist(DynamiteLocation, Cattle->GetActorLocation());
-				const float ProximityFactor = 1.0f - (Distance / FuseFearRadius);
-				const float FearToAdd = FuseFearPerSecond * ProximityFactor * DeltaTime;
-
-				Cattle->AddFear(FearToAdd);
-			}
-		}
+		// Closer cattle get more fear through the field's falloff
+		FearField->AddFear(GetActorLocation(), FuseFearRadius, FuseFearPerSecond * DeltaTime);
 	}
 }
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Delegates/Delegate.h"
+#include "CattleGame/Animals/Stimuli/CattleStimulusSubsystem.h"
 #include "DynamiteProjectile.generated.h"
 
 class USphereComponent;
@@ -34,6 +35,7 @@ public:
 	ADynamiteProjectile();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 
 	// ===== PROJECTILE CONTROL =====
@@ -111,7 +113,7 @@ protected:
 
 	// ===== CATTLE FEAR PROPERTIES =====
 
-	/** Fear applied to cattle in explosion radius */
+	/** Fear applied to cattle in explosion radius; full at the center, falling off to zero at the edge, and delivered over a moment through the fear field */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Explosion|Cattle")
 	float ExplosionFearAmount = 100.0f;
 
@@ -136,6 +138,9 @@ protected:
 	/** Timer handle for explosion */
 	FTimerHandle ExplosionTimerHandle;
 
+	/** Explosive stimulus published while the fuse burns */
+	FCattleStimulusHandle FuseStimulus;
+
 private:
 	/** Handle collision with world (ground, walls) */
 	UFUNCTION()
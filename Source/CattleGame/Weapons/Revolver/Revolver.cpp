@@ -1,6 +1,7 @@
 #include "Revolver.h"
 #include "CattleGame/Character/CattleCharacter.h"
 #include "CattleGame/Animals/CattleAnimal.h"
+#include "CattleGame/Animals/Fear/CattleFearFieldSubsystem.h"
 #include "GameFramework/Character.h"
 #include "Camera/CameraComponent.h"
 #include "Kismet/GameplayStatics.h"
@@ -177,6 +178,13 @@ void ARevolver::OnServerFire(const FVector &TraceStart, const FVector &TraceDir)
 	UE_LOG(LogGASDebug, Warning, TEXT("Revolver::OnServerFire [SERVER] - %p Ammo %d->%d"), this, AmmoBefore, CurrentAmmo);
 	ForceNetUpdate();
 
+	// Let nearby cattle know a shot was fired
+	if (UCattleStimulusSubsystem *StimulusSubsystem = GetWorld()->GetSubsystem<UCattleStimulusSubsystem>())
+	{
+		StimulusSubsystem->RemoveStimulus(GunshotStimulus);
+		GunshotStimulus = StimulusSubsystem->PublishStimulus(ECattleStimulusType::Gunshot, OwnerCharacter, OwnerCharacter, GunshotFearRadius, GunshotStimulusDuration);
+	}
+
 	// Apply optional spread
 	FVector FireDir = TraceDir;
 	if (WeaponSpread > 0.0f)
@@ -200,6 +208,9 @@ void ARevolver::OnServerFire(const FVector &TraceStart, const FVector &TraceDir)
 		ECC_WorldDynamic,
 		QueryParams);
 
+	UCattleFearFieldSubsystem *FearField = GetWorld()->GetSubsystem<UCattleFearFieldSubsystem>();
+	const bool bGunshotFear = FearField && GunshotFearRadius > 0.0f && GunshotFearAmount > 0.0f;
+
 	if (bHit && HitResult.GetActor())
 	{
 		ApplyDamageToActor(HitResult.GetActor(), HitResult.ImpactPoint, FireDir);
@@ -207,8 +218,17 @@ void ARevolver::OnServerFire(const FVector &TraceStart, const FVector &TraceDir)
 		// Apply fear to cattle if hit directly
 		if (ACattleAnimal *HitCattle = Cast<ACattleAnimal>(HitResult.GetActor()))
 		{
-			HitCattle->AddFear(FearOnHit);
-			UE_LOG(LogGASDebug, Warning, TEXT("Revolver::OnServerFire - Applied %.0f fear to %s"), FearOnHit, *HitCattle->GetName());
+			// Don't double-apply fear to the one we hit; the gunshot deposit below reaches it too
+			float FearToAdd = FearOnHit;
+			if (bGunshotFear)
+			{
+				FearToAdd -= FearField->GetDepositedFear(TraceStart, GunshotFearRadius, GunshotFearAmount, HitCattle->GetActorLocation());
+			}
+
+			FearToAdd = FMath::Max(FearToAdd, 0.0f);
+
+			HitCattle->AddFear(FearToAdd);
+			UE_LOG(LogGASDebug, Warning, TEXT("Revolver::OnServerFire - Applied %.0f fear to %s"), FearToAdd, *HitCattle->GetName());
 		}
 
 		// Trigger impact GameplayCue via owner's ASC (ensures proper replication)
@@ -240,34 +260,9 @@ void ARevolver::OnServerFire(const FVector &TraceStart, const FVector &TraceDir)
 	}
 
 	// Apply area fear to nearby cattle from gunshot sound
-	if (GunshotFearRadius > 0.0f && GunshotFearAmount > 0.0f)
+	if (bGunshotFear)
 	{
-		const FVector SoundOrigin = TraceStart;
-		TArray<FOverlapResult> OverlapResults;
-		FCollisionShape SphereShape = FCollisionShape::MakeSphere(GunshotFearRadius);
-
-		if (GetWorld()->OverlapMultiByChannel(
-				OverlapResults,
-				SoundOrigin,
-				FQuat::Identity,
-				ECC_Pawn,
-				SphereShape))
-		{
-			for (const FOverlapResult &Overlap : OverlapResults)
-			{
-				if (ACattleAnimal *Cattle = Cast<ACattleAnimal>(Overlap.GetActor()))
-				{
-					// Don't double-apply fear to the one we already hit
-					if (bHit && Overlap.GetActor() == HitResult.GetActor())
-					{
-						continue;
-					}
-
-					Cattle->AddFear(GunshotFearAmount);
-					UE_LOG(LogGASDebug, Verbose, TEXT("Revolver::OnServerFire - Gunshot fear %.0f to nearby %s"), GunshotFearAmount, *Cattle->GetName());
-				}
-			}
-		}
+		FearField->AddFear(TraceStart, GunshotFearRadius, GunshotFearAmount);
 	}
 }
 
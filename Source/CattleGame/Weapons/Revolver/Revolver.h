@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "CattleGame/Weapons/HitscanWeaponBase.h"
+#include "CattleGame/Animals/Stimuli/CattleStimulusSubsystem.h"
 #include "Revolver.generated.h"
 
 class UParticleSystem;
@@ -53,11 +54,11 @@ public:
 
 	// ===== CATTLE FEAR PROPERTIES =====
 
-	/** Fear applied to cattle when hit directly */
+	/** Fear applied to cattle when hit directly, including their share of the gunshot fear */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Revolver|Cattle")
 	float FearOnHit = 80.0f;
 
-	/** Fear applied to nearby cattle from gunshot sound */
+	/** Fear applied to nearby cattle from gunshot sound; full at the shooter, falling off to zero at GunshotFearRadius, and delivered over a moment through the fear field */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Revolver|Cattle")
 	float GunshotFearAmount = 30.0f;
 
@@ -65,6 +66,10 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Revolver|Cattle")
 	float GunshotFearRadius = 1500.0f;
 
+	/** How long nearby cattle remember a gunshot */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Revolver|Cattle")
+	float GunshotStimulusDuration = 2.0f;
+
 	// ===== STATE TRACKING =====
 
 	/** Is the weapon currently being reloaded? */
@@ -74,6 +79,9 @@ public:
 	/** Timestamp of last fire for fire rate limiting */
 	float LastFireTime = -9999.0f;
 
+	/** Gunshot stimulus of the most recent shot; each shot replaces it */
+	FCattleStimulusHandle GunshotStimulus;
+
 	// ===== UTILITY FUNCTIONS =====
 
 	/**
@@ -1,6 +1,7 @@
 #include "Trumpet.h"
 #include "CattleGame/Character/CattleCharacter.h"
 #include "CattleGame/Animals/CattleAnimal.h"
+#include "CattleGame/Animals/Fear/CattleFearFieldSubsystem.h"
 #include "Components/StaticMeshComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -30,6 +31,16 @@ void ATrumpet::BeginPlay()
 	Super::BeginPlay();
 }
 
+void ATrumpet::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UCattleStimulusSubsystem *StimulusSubsystem = GetWorld()->GetSubsystem<UCattleStimulusSubsystem>())
+	{
+		StimulusSubsystem->RemoveStimulus(PlayingStimulus);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ATrumpet::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -67,6 +78,7 @@ void ATrumpet::PlayLure()
 	{
 		// Already playing Scare, switch to Lure
 		bIsPlayingLure = true;
+		PublishPlayingStimulus();
 		UE_LOG(LogGASDebug, Warning, TEXT("Trumpet::PlayLure - Switched from Scare to Lure"));
 	}
 	else if (!bIsPlaying)
@@ -74,6 +86,7 @@ void ATrumpet::PlayLure()
 		// Not playing, start Lure
 		bIsPlaying = true;
 		bIsPlayingLure = true;
+		PublishPlayingStimulus();
 		OnTrumpetStarted.Broadcast();
 		UE_LOG(LogGASDebug, Warning, TEXT("Trumpet::PlayLure - Playing Lure"));
 	}
@@ -90,6 +103,7 @@ void ATrumpet::PlayScare()
 	{
 		// Already playing Lure, switch to Scare
 		bIsPlayingLure = false;
+		PublishPlayingStimulus();
 		UE_LOG(LogGASDebug, Warning, TEXT("Trumpet::PlayScare - Switched from Lure to Scare"));
 	}
 	else if (!bIsPlaying)
@@ -97,6 +111,7 @@ void ATrumpet::PlayScare()
 		// Not playing, start Scare
 		bIsPlaying = true;
 		bIsPlayingLure = false;
+		PublishPlayingStimulus();
 		OnTrumpetStarted.Broadcast();
 		UE_LOG(LogGASDebug, Warning, TEXT("Trumpet::PlayScare - Playing Scare"));
 	}
@@ -116,11 +131,34 @@ void ATrumpet::StopPlaying()
 
 	bIsPlaying = false;
 	bIsPlayingLure = false;
+
+	if (UCattleStimulusSubsystem *StimulusSubsystem = GetWorld()->GetSubsystem<UCattleStimulusSubsystem>())
+	{
+		StimulusSubsystem->RemoveStimulus(PlayingStimulus);
+	}
+
 	OnTrumpetStopped.Broadcast();
 
 	UE_LOG(LogGASDebug, Warning, TEXT("Trumpet::StopPlaying - Trumpet stopped"));
 }
 
+void ATrumpet::PublishPlayingStimulus()
+{
+	UCattleStimulusSubsystem *StimulusSubsystem = GetWorld()->GetSubsystem<UCattleStimulusSubsystem>();
+	if (!StimulusSubsystem)
+	{
+		return;
+	}
+
+	StimulusSubsystem->RemoveStimulus(PlayingStimulus);
+
+	// The sound follows the player holding the trumpet
+	AActor *Player = OwnerCharacter ? static_cast<AActor *>(OwnerCharacter) : this;
+	PlayingStimulus = bIsPlayingLure
+						  ? StimulusSubsystem->PublishStimulus(ECattleStimulusType::Lure, Player, Player, LureRadius)
+						  : StimulusSubsystem->PublishStimulus(ECattleStimulusType::Scare, Player, Player, ScareRadius);
+}
+
 void ATrumpet::ApplyLureEffects(float DeltaTime)
 {
 	if (!OwnerCharacter)
@@ -150,11 +188,14 @@ void ATrumpet::ApplyLureEffects(float DeltaTime)
 
 void ATrumpet::ApplyScareEffects(float DeltaTime)
 {
-	TArray<ACattleAnimal *> NearbyCattle = GetCattleInRadius(ScareRadius);
+	if (!OwnerCharacter)
+	{
+		return;
+	}
 
-	for (ACattleAnimal *Cattle : NearbyCattle)
+	if (UCattleFearFieldSubsystem *FearField = GetWorld()->GetSubsystem<UCattleFearFieldSubsystem>())
 	{
-		Cattle->AddFear(FearPerSecond * DeltaTime);
+		FearField->AddFear(OwnerCharacter->GetActorLocation(), ScareRadius, FearPerSecond * DeltaTime);
 	}
 }
 
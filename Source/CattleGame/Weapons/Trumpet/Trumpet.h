@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "CattleGame/Weapons/WeaponBase.h"
 #include "Delegates/Delegate.h"
+#include "CattleGame/Animals/Stimuli/CattleStimulusSubsystem.h"
 #include "Trumpet.generated.h"
 
 class UStaticMeshComponent;
@@ -75,6 +76,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// ===== STATE =====
 
@@ -127,4 +129,10 @@ private:
 
 	/** Get all cattle within a radius using sphere overlap */
 	TArray<ACattleAnimal *> GetCattleInRadius(float Radius) const;
+
+	/** Publish the stimulus for the current mode, replacing the previous one */
+	void PublishPlayingStimulus();
+
+	/** Lure/scare stimulus published while playing */
+	FCattleStimulusHandle PlayingStimulus;
 };